@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "./env.h"
+#include "./block.h"
+#include "./jit.h"
+#include "./simulation.h"
+#include "./inst_list.h"
+#include "./trace.h"
+
+/*!
+ * operations which have fast path in block dispatcher.
+ * other instructions are executed by calling their handler.
+ */
+typedef enum {
+    blockOpCall, blockOpCallEnd, blockOpNop, blockOpExit,
+    blockOpLUI, blockOpAUIPC, blockOpJAL, blockOpJALR,
+    blockOpBEQ, blockOpBNE, blockOpBLT, blockOpBGE, blockOpBLTU, blockOpBGEU,
+    blockOpLB, blockOpLH, blockOpLW, blockOpLBU, blockOpLHU,
+    blockOpADDI, blockOpSLTI, blockOpXORI, blockOpORI, blockOpANDI,
+    blockOpSLLI, blockOpSRLI, blockOpSRAI,
+    blockOpADD, blockOpSLL, blockOpSLT, blockOpSLTU, blockOpXOR,
+    blockOpSRL, blockOpSRA, blockOpOR, blockOpAND, blockOpMUL,
+    /* superinstructions */
+    blockOpLUI_ADDI, blockOpAUIPC_ADDI, blockOpAUIPC_JALR, blockOpSLLI_ADD,
+    blockOpSLT_BEQZ, blockOpSLT_BNEZ, blockOpSLTU_BEQZ, blockOpSLTU_BNEZ,
+    blockOpSLTI_BEQZ, blockOpSLTI_BNEZ,
+    blockOpTail
+} blockOp;
+
+const char * const block_fusion_name[fuseTail] = {
+    [fuseLuiAddi]   = "lui+addi",
+    [fuseAuipcAddi] = "auipc+addi",
+    [fuseAuipcJalr] = "auipc+jalr",
+    [fuseSlliAdd]   = "slli+add",
+    [fuseCmpBranch] = "compare+branch",
+};
+
+static block    BuildBlock (Addr_t, const void * const *, riscvEnv);
+static block    LookupBlock (Addr_t, const void * const *, riscvEnv);
+static blockOp  SelectBlockOp (const decodedInst *);
+static blockOp  SelectFusedOp (blockOp, const blockInst *, blockOp, const blockInst *);
+
+
+/*!
+ * create basic block cache
+ */
+blockCache CreateBlockCache (void)
+{
+    blockCache bc = (blockCache) checked_malloc (sizeof (*bc));
+    memset (bc, 0, sizeof (*bc));
+    bc->pool = (Byte_t *) checked_malloc (BLOCK_POOL_SIZE);
+    return bc;
+}
+
+
+/*!
+ * release basic block cache
+ * \param bc  block cache, may be NULL
+ */
+void DestroyBlockCache (blockCache bc)
+{
+    if (bc == NULL) {
+        return;
+    }
+    free (bc->pool);
+    free (bc);
+}
+
+
+/*!
+ * throw away all blocks.
+ * block under execution is still readable until next block is built.
+ * \param env  RISC-V environment
+ */
+void FlushBlockCache (riscvEnv env)
+{
+    blockCache bc = env->block_cache;
+    if (bc == NULL) {
+        return;
+    }
+    memset (bc->table, 0, sizeof (bc->table));
+    memset (bc->code_page, 0, sizeof (bc->code_page));
+    bc->pool_used = 0;
+    bc->flushed = true;
+    bc->flushes++;
+
+    /* translated code is reached only through blocks */
+    FlushJITCache (env);
+}
+
+
+/*!
+ * invalidate blocks when store hits a page which has blocks
+ * \param addr  address of stored data
+ * \param env   RISC-V environment
+ */
+void InvalidateBlockCache (Addr_t addr, riscvEnv env)
+{
+    blockCache bc = env->block_cache;
+    uint32_t   page = addr >> MEM_PAGE_BITS;
+    if (bc != NULL && (bc->code_page[page / 32] & (1U << (page % 32))) != 0) {
+        FlushBlockCache (env);
+    }
+}
+
+
+/*!
+ * run simulation by basic blocks without instruction trace
+ * \param step_count  number of instructions to be executed
+ * \param env         RISC-V environment
+ */
+void ExecBlockSimulation (uint32_t step_count, riscvEnv env)
+{
+    static const void * const labels[blockOpTail] = {
+        [blockOpCall]    = &&op_call,   [blockOpCallEnd] = &&op_call_end,
+        [blockOpNop]     = &&op_nop,    [blockOpExit]    = &&op_exit,
+        [blockOpLUI]     = &&op_lui,    [blockOpAUIPC]   = &&op_auipc,
+        [blockOpJAL]     = &&op_jal,    [blockOpJALR]    = &&op_jalr,
+        [blockOpBEQ]     = &&op_beq,    [blockOpBNE]     = &&op_bne,
+        [blockOpBLT]     = &&op_blt,    [blockOpBGE]     = &&op_bge,
+        [blockOpBLTU]    = &&op_bltu,   [blockOpBGEU]    = &&op_bgeu,
+        [blockOpLB]      = &&op_lb,     [blockOpLH]      = &&op_lh,
+        [blockOpLW]      = &&op_lw,     [blockOpLBU]     = &&op_lbu,
+        [blockOpLHU]     = &&op_lhu,
+        [blockOpADDI]    = &&op_addi,   [blockOpSLTI]    = &&op_slti,
+        [blockOpXORI]    = &&op_xori,   [blockOpORI]     = &&op_ori,
+        [blockOpANDI]    = &&op_andi,   [blockOpSLLI]    = &&op_slli,
+        [blockOpSRLI]    = &&op_srli,   [blockOpSRAI]    = &&op_srai,
+        [blockOpADD]     = &&op_add,    [blockOpSLL]     = &&op_sll,
+        [blockOpSLT]     = &&op_slt,    [blockOpSLTU]    = &&op_sltu,
+        [blockOpXOR]     = &&op_xor,    [blockOpSRL]     = &&op_srl,
+        [blockOpSRA]     = &&op_sra,    [blockOpOR]      = &&op_or,
+        [blockOpAND]     = &&op_and,    [blockOpMUL]     = &&op_mul,
+        [blockOpLUI_ADDI]   = &&op_lui_addi,   [blockOpAUIPC_ADDI] = &&op_auipc_addi,
+        [blockOpAUIPC_JALR] = &&op_auipc_jalr, [blockOpSLLI_ADD]   = &&op_slli_add,
+        [blockOpSLT_BEQZ]   = &&op_slt_beqz,   [blockOpSLT_BNEZ]   = &&op_slt_bnez,
+        [blockOpSLTU_BEQZ]  = &&op_sltu_beqz,  [blockOpSLTU_BNEZ]  = &&op_sltu_bnez,
+        [blockOpSLTI_BEQZ]  = &&op_slti_beqz,  [blockOpSLTI_BNEZ]  = &&op_slti_bnez,
+    };
+
+    if (env->block_cache == NULL) {
+        env->block_cache = CreateBlockCache ();
+    }
+
+    blockCache       bc   = env->block_cache;
+    Word_t          *regs = env->regs;
+    block            blk  = NULL;
+    const blockInst *ip;
+
+#define DISPATCH()  goto *(++ip)->label
+#define R(idx)      (regs[idx])
+#define UR(idx)     ((UWord_t)regs[idx])
+#define BRANCH(cond)                                                    \
+    do {                                                                \
+        env->pc = (cond) ? ip->pc + ip->imm : ip->next_pc;              \
+        goto block_end;                                                 \
+    } while (0)
+/* compare and branch on its result, ip is moved to branch */
+#define CMP_BRANCH(cmp, taken_if_set)                                   \
+    do {                                                                \
+        Word_t res = (cmp) ? 1 : 0;                                     \
+        R(ip->rd) = res;                                                \
+        bc->fused[fuseCmpBranch]++;                                     \
+        ip++;                                                           \
+        BRANCH (res == (taken_if_set));                                 \
+    } while (0)
+
+    bool first = true;
+    while (step_count > 0 && env->stop_reason == stopNone) {
+        /* follow chain of previous block, or look up block table */
+        block next = NULL;
+        if (blk != NULL && bc->flushed == false) {
+            int dir = (env->pc == blk->succ_pc[0]) ? 0 :
+                      (env->pc == blk->succ_pc[1]) ? 1 : -1;
+            if (dir >= 0 && blk->succ[dir] != NULL) {
+                next = blk->succ[dir];
+                bc->chained++;
+            } else {
+                next = LookupBlock (env->pc, labels, env);
+                if (bc->flushed == false) {
+                    dir = (env->pc == blk->insts[blk->len - 1].next_pc) ? 1 : 0;
+                    blk->succ_pc[dir] = env->pc;
+                    blk->succ[dir] = next;
+                }
+            }
+        } else {
+            next = LookupBlock (env->pc, labels, env);
+        }
+        bc->flushed = false;
+        blk = next;
+
+        if (blk->breakpoint && first == false) {
+            env->stop_reason = stopBreakpoint;
+            break;
+        }
+        first = false;
+
+        if (blk->len > step_count) {
+            /* budget ends in the middle of block */
+            StepSimulationNoTrace (step_count, env);
+            break;
+        }
+        step_count -= blk->len;
+        env->step  += blk->len;
+
+        if (env->jit_cache != NULL) {
+            if (blk->jit_code == NULL && ++blk->exec_count == JIT_THRESHOLD) {
+                TranslateBlock (blk, env);
+            }
+            if (blk->jit_code != NULL) {
+                ((jitFunc)blk->jit_code) (env);
+                continue;
+            }
+        }
+
+        clearTraceInfo (env->trace);
+        ip = blk->insts;
+        goto *ip->label;
+
+    op_call:
+        env->pc = env->current_pc = ip->pc;
+        env->inst_len = ip->next_pc - ip->pc;
+        ip->exec (&ip->operand, env);
+        if (env->stop_reason != stopNone) {
+            /* stop after this instruction as step engines do, rest of block is not run */
+            env->step -= blk->len - (ip - blk->insts + 1);
+            env->pc = ip->next_pc;
+            goto block_end;
+        }
+        DISPATCH ();
+    op_call_end:
+        clearTraceInfo (env->trace);
+        env->pc = env->current_pc = ip->pc;
+        env->inst_len = ip->next_pc - ip->pc;
+        ip->exec (&ip->operand, env);
+        if (env->trace->isbranch == false) {
+            env->pc = ip->next_pc;
+        }
+        goto block_end;
+    op_nop:
+        DISPATCH ();
+    op_exit:
+        env->pc = ip->pc;
+        goto block_end;
+
+    op_lui:   R(ip->rd) = ip->imm;                                   DISPATCH ();
+    op_auipc: R(ip->rd) = ip->imm + ip->pc;                          DISPATCH ();
+    op_jal:
+        if (ip->rd != 0) {
+            R(ip->rd) = ip->next_pc;
+        }
+        env->pc = ip->pc + ip->imm;
+        goto block_end;
+    op_jalr: {
+        Addr_t target = R(ip->rs1) + ip->imm;
+        if (ip->rd != 0) {
+            R(ip->rd) = ip->next_pc;
+        }
+        env->pc = target;
+        goto block_end;
+    }
+    op_beq:   BRANCH (R(ip->rs1) == R(ip->rs2));
+    op_bne:   BRANCH (R(ip->rs1) != R(ip->rs2));
+    op_blt:   BRANCH (R(ip->rs1) <  R(ip->rs2));
+    op_bge:   BRANCH (R(ip->rs1) >= R(ip->rs2));
+    op_bltu:  BRANCH (UR(ip->rs1) <  UR(ip->rs2));
+    op_bgeu:  BRANCH (UR(ip->rs1) >= UR(ip->rs2));
+
+    op_lb: {
+        Word_t res = (Word_t)(int8_t)LoadMemoryNoTrace (R(ip->rs1) + ip->imm, Size_Byte, env);
+        if (ip->rd != 0) { R(ip->rd) = res; }
+        DISPATCH ();
+    }
+    op_lh: {
+        Word_t res = (Word_t)(int16_t)LoadMemoryNoTrace (R(ip->rs1) + ip->imm, Size_HWord, env);
+        if (ip->rd != 0) { R(ip->rd) = res; }
+        DISPATCH ();
+    }
+    op_lw: {
+        Word_t res = LoadMemoryNoTrace (R(ip->rs1) + ip->imm, Size_Word, env);
+        if (ip->rd != 0) { R(ip->rd) = res; }
+        DISPATCH ();
+    }
+    op_lbu: {
+        Word_t res = LoadMemoryNoTrace (R(ip->rs1) + ip->imm, Size_Byte, env) & 0x000000ff;
+        if (ip->rd != 0) { R(ip->rd) = res; }
+        DISPATCH ();
+    }
+    op_lhu: {
+        Word_t res = LoadMemoryNoTrace (R(ip->rs1) + ip->imm, Size_HWord, env) & 0x0000ffff;
+        if (ip->rd != 0) { R(ip->rd) = res; }
+        DISPATCH ();
+    }
+
+    /* rd == r0 is turned into blockOpNop at build time */
+    op_addi:  R(ip->rd) = R(ip->rs1) + ip->imm;                      DISPATCH ();
+    op_slti:  R(ip->rd) = (R(ip->rs1) < ip->imm) ? 1 : 0;            DISPATCH ();
+    op_xori:  R(ip->rd) = R(ip->rs1) ^ ip->imm;                      DISPATCH ();
+    op_ori:   R(ip->rd) = R(ip->rs1) | ip->imm;                      DISPATCH ();
+    op_andi:  R(ip->rd) = R(ip->rs1) & ip->imm;                      DISPATCH ();
+    op_slli:  R(ip->rd) = R(ip->rs1) << ip->rs2;                     DISPATCH ();
+    op_srli:  R(ip->rd) = UR(ip->rs1) >> ip->rs2;                    DISPATCH ();
+    op_srai:  R(ip->rd) = R(ip->rs1) >> ip->rs2;                     DISPATCH ();
+    op_add:   R(ip->rd) = R(ip->rs1) + R(ip->rs2);                   DISPATCH ();
+    op_sll:   R(ip->rd) = R(ip->rs1) << (R(ip->rs2) & 0x1f);         DISPATCH ();
+    op_slt:   R(ip->rd) = (R(ip->rs1) < R(ip->rs2)) ? 1 : 0;         DISPATCH ();
+    op_sltu:  R(ip->rd) = (UR(ip->rs1) < UR(ip->rs2)) ? 1 : 0;       DISPATCH ();
+    op_xor:   R(ip->rd) = R(ip->rs1) ^ R(ip->rs2);                   DISPATCH ();
+    op_srl:   R(ip->rd) = UR(ip->rs1) >> (R(ip->rs2) & 0x1f);        DISPATCH ();
+    op_sra:   R(ip->rd) = R(ip->rs1) >> (R(ip->rs2) & 0x1f);         DISPATCH ();
+    op_or:    R(ip->rd) = R(ip->rs1) | R(ip->rs2);                   DISPATCH ();
+    op_and:   R(ip->rd) = R(ip->rs1) & R(ip->rs2);                   DISPATCH ();
+    op_mul:   R(ip->rd) = R(ip->rs1) * R(ip->rs2);                   DISPATCH ();
+
+    /*
+     * superinstructions, ip[1] is second instruction of pair.
+     * both destination registers are written as separate instructions do.
+     */
+    op_lui_addi:
+        R(ip->rd)   = ip->imm;
+        R(ip[1].rd) = ip->imm + ip[1].imm;
+        bc->fused[fuseLuiAddi]++;
+        ip++;
+        DISPATCH ();
+    op_auipc_addi:
+        R(ip->rd)   = ip->pc + ip->imm;
+        R(ip[1].rd) = ip->pc + ip->imm + ip[1].imm;
+        bc->fused[fuseAuipcAddi]++;
+        ip++;
+        DISPATCH ();
+    op_auipc_jalr:
+        R(ip->rd) = ip->pc + ip->imm;
+        if (ip[1].rd != 0) {
+            R(ip[1].rd) = ip[1].next_pc;
+        }
+        env->pc = ip->pc + ip->imm + ip[1].imm;
+        bc->fused[fuseAuipcJalr]++;
+        goto block_end;
+    op_slli_add:
+        R(ip->rd)   = R(ip->rs1) << ip->rs2;
+        R(ip[1].rd) = R(ip[1].rs1) + R(ip[1].rs2);
+        bc->fused[fuseSlliAdd]++;
+        ip++;
+        DISPATCH ();
+    op_slt_beqz:   CMP_BRANCH (R(ip->rs1) <  R(ip->rs2), 0);
+    op_slt_bnez:   CMP_BRANCH (R(ip->rs1) <  R(ip->rs2), 1);
+    op_sltu_beqz:  CMP_BRANCH (UR(ip->rs1) < UR(ip->rs2), 0);
+    op_sltu_bnez:  CMP_BRANCH (UR(ip->rs1) < UR(ip->rs2), 1);
+    op_slti_beqz:  CMP_BRANCH (R(ip->rs1) <  ip->imm, 0);
+    op_slti_bnez:  CMP_BRANCH (R(ip->rs1) <  ip->imm, 1);
+
+    block_end:
+        ;
+    }
+
+#undef DISPATCH
+#undef R
+#undef UR
+#undef BRANCH
+#undef CMP_BRANCH
+    return;
+}
+
+
+/*!
+ * look up block by head address, build it if not found
+ */
+static block LookupBlock (Addr_t pc, const void * const *labels, riscvEnv env)
+{
+    blockCache bc  = env->block_cache;
+    block      blk = bc->table[BLOCK_TABLE_INDEX (pc)];
+    if (blk != NULL && blk->pc == pc) {
+        return blk;
+    }
+    blk = BuildBlock (pc, labels, env);
+    bc->table[BLOCK_TABLE_INDEX (pc)] = blk;
+    return blk;
+}
+
+
+/*!
+ * build new block from pre-decoded instructions
+ */
+static block BuildBlock (Addr_t pc, const void * const *labels, riscvEnv env)
+{
+    blockCache bc   = env->block_cache;
+    size_t     size = sizeof (struct __block) + sizeof (blockInst) * (BLOCK_MAX_INSTS + 1);
+    size = (size + 15) & ~(size_t)15;
+
+    if (bc->pool_used + size > BLOCK_POOL_SIZE) {
+        FlushBlockCache (env);
+    }
+    block blk = (block)(bc->pool + bc->pool_used);
+    blk->pc = pc;
+    blk->succ_pc[0] = blk->succ_pc[1] = DEC_CACHE_INVALID;
+    blk->succ[0] = blk->succ[1] = NULL;
+    blk->exec_count = 0;
+    blk->jit_code = NULL;
+    blk->breakpoint = IsBreakpoint (pc, env);
+
+    blockOp  ops[BLOCK_MAX_INSTS];
+    uint32_t len = 0;
+    Addr_t   inst_pc = pc;
+    bool     end = false;
+    while (len < BLOCK_MAX_INSTS && end == false) {
+        decodedInst *dec = FetchDecodedInst (inst_pc, env);
+        if (len > 0 && dec->breakpoint) {
+            /* breakpoint is always head of block */
+            break;
+        }
+        if (dec->inst_idx == -1) {
+            if (len == 0) {
+                fprintf (env->dbgfp, "<Error: instruction is not decoded. [%08x]=%08x\n", inst_pc, dec->inst_hex);
+                exit (EXIT_FAILURE);
+            }
+            break;
+        }
+        blockInst *ip = &blk->insts[len];
+        ops[len]     = SelectBlockOp (dec);
+        ip->label    = labels[ops[len]];
+        ip->exec     = dec->exec_notrace;
+        ip->operand  = dec->operand;
+        ip->inst_idx = dec->inst_idx;
+        ip->pc       = inst_pc;
+        ip->next_pc  = inst_pc + dec->inst_len;
+        ip->rd       = dec->rd;
+        ip->rs1      = dec->rs1;
+        ip->rs2      = dec->rs2;
+        ip->imm      = dec->imm;
+
+        /* instruction on halfword boundary may cross page */
+        uint32_t page = inst_pc >> MEM_PAGE_BITS;
+        bc->code_page[page / 32] |= (1U << (page % 32));
+        page = (ip->next_pc - 1) >> MEM_PAGE_BITS;
+        bc->code_page[page / 32] |= (1U << (page % 32));
+
+        end = IsBlockTerminator (dec->inst_idx);
+        inst_pc = ip->next_pc;
+        len++;
+    }
+    if (end == false) {
+        /* block is cut, continue from next instruction */
+        blk->insts[len].label = labels[blockOpExit];
+        blk->insts[len].pc    = inst_pc;
+    }
+    blk->len = len;
+
+    /* replace head of idiomatic pairs by superinstructions */
+    uint32_t i;
+    for (i = 0; i + 1 < len; i++) {
+        blockOp fused = SelectFusedOp (ops[i], &blk->insts[i], ops[i + 1], &blk->insts[i + 1]);
+        if (fused != blockOpTail) {
+            blk->insts[i].label = labels[fused];
+            i++;
+        }
+    }
+
+    bc->pool_used += size;
+    bc->built++;
+    return blk;
+}
+
+
+/*!
+ * select dispatch target of pre-decoded instruction
+ */
+static blockOp SelectBlockOp (const decodedInst *dec)
+{
+    bool rd_zero = (dec->rd == 0);
+
+    switch (dec->inst_idx) {
+    case INST_LUI   : return rd_zero ? blockOpNop : blockOpLUI;
+    case INST_AUIPC : return rd_zero ? blockOpNop : blockOpAUIPC;
+    case INST_JAL   : return blockOpJAL;
+    case INST_JALR  : return blockOpJALR;
+    case INST_BEQ   : return blockOpBEQ;
+    case INST_BNE   : return blockOpBNE;
+    case INST_BLT   : return blockOpBLT;
+    case INST_BGE   : return blockOpBGE;
+    case INST_BLTU  : return blockOpBLTU;
+    case INST_BGEU  : return blockOpBGEU;
+    case INST_LB    : return blockOpLB;
+    case INST_LH    : return blockOpLH;
+    case INST_LW    : return blockOpLW;
+    case INST_LBU   : return blockOpLBU;
+    case INST_LHU   : return blockOpLHU;
+    case INST_ADDI  : return rd_zero ? blockOpNop : blockOpADDI;
+    case INST_SLTI  : return rd_zero ? blockOpNop : blockOpSLTI;
+    case INST_XORI  : return rd_zero ? blockOpNop : blockOpXORI;
+    case INST_ORI   : return rd_zero ? blockOpNop : blockOpORI;
+    case INST_ANDI  : return rd_zero ? blockOpNop : blockOpANDI;
+    case INST_SLLI  : return rd_zero ? blockOpNop : blockOpSLLI;
+    case INST_SRLI  : return rd_zero ? blockOpNop : blockOpSRLI;
+    case INST_SRAI  : return rd_zero ? blockOpNop : blockOpSRAI;
+    case INST_ADD   : return rd_zero ? blockOpNop : blockOpADD;
+    case INST_SLL   : return rd_zero ? blockOpNop : blockOpSLL;
+    case INST_SLT   : return rd_zero ? blockOpNop : blockOpSLT;
+    case INST_SLTU  : return rd_zero ? blockOpNop : blockOpSLTU;
+    case INST_XOR   : return rd_zero ? blockOpNop : blockOpXOR;
+    case INST_SRL   : return rd_zero ? blockOpNop : blockOpSRL;
+    case INST_SRA   : return rd_zero ? blockOpNop : blockOpSRA;
+    case INST_OR    : return rd_zero ? blockOpNop : blockOpOR;
+    case INST_AND   : return rd_zero ? blockOpNop : blockOpAND;
+    case INST_MUL   : return rd_zero ? blockOpNop : blockOpMUL;
+    default :
+        return IsBlockTerminator (dec->inst_idx) ? blockOpCallEnd : blockOpCall;
+    }
+}
+
+
+/*!
+ * select superinstruction for pair of instructions
+ * second instruction must consume result of first one.
+ * \return blockOpTail if pair is not fused
+ */
+static blockOp SelectFusedOp (blockOp op0, const blockInst *ip0, blockOp op1, const blockInst *ip1)
+{
+    RegAddr_t rd = ip0->rd;
+
+    switch (op0) {
+    case blockOpLUI :
+        if (op1 == blockOpADDI && ip1->rs1 == rd) { return blockOpLUI_ADDI; }
+        break;
+    case blockOpAUIPC :
+        if (op1 == blockOpADDI && ip1->rs1 == rd) { return blockOpAUIPC_ADDI; }
+        if (op1 == blockOpJALR && ip1->rs1 == rd) { return blockOpAUIPC_JALR; }
+        break;
+    case blockOpSLLI :
+        if (op1 == blockOpADD && (ip1->rs1 == rd || ip1->rs2 == rd)) { return blockOpSLLI_ADD; }
+        break;
+    case blockOpSLT : case blockOpSLTU : case blockOpSLTI : {
+        /* beqz / bnez on result of compare */
+        if ((op1 != blockOpBEQ && op1 != blockOpBNE) ||
+            !((ip1->rs1 == rd && ip1->rs2 == 0) || (ip1->rs1 == 0 && ip1->rs2 == rd))) {
+            break;
+        }
+        bool bnez = (op1 == blockOpBNE);
+        return (op0 == blockOpSLT)  ? (bnez ? blockOpSLT_BNEZ  : blockOpSLT_BEQZ)  :
+               (op0 == blockOpSLTU) ? (bnez ? blockOpSLTU_BNEZ : blockOpSLTU_BEQZ) :
+                                      (bnez ? blockOpSLTI_BNEZ : blockOpSLTI_BEQZ);
+    }
+    default :
+        break;
+    }
+    return blockOpTail;
+}
+
+
+/*!
+ * instructions which may change control flow terminate block
+ */
+bool IsBlockTerminator (uint32_t inst_idx)
+{
+    switch (inst_idx) {
+    case INST_JAL  : case INST_JALR :
+    case INST_BEQ  : case INST_BNE  : case INST_BLT : case INST_BGE :
+    case INST_BLTU : case INST_BGEU :
+    case INST_FENCE_I :
+    case INST_SCALL : case INST_SBREAK :
+        return true;
+    default :
+        return false;
+    }
+}
+
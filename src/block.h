@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "./basic.h"
+#include "./env.h"
+#include "./dec_cache.h"
+
+/*!
+ * Basic block cache
+ * a block is a sequence of pre-decoded instructions which ends at
+ * branch / jump (or other instruction which may change control flow).
+ * blocks are carved from one pool and thrown away all together when
+ * pool is exhausted or code is modified.
+ */
+#define BLOCK_MAX_INSTS    64
+#define BLOCK_TABLE_BITS   12
+#define BLOCK_TABLE_SIZE   (1 << BLOCK_TABLE_BITS)
+#define BLOCK_TABLE_INDEX(pc) (((pc) >> 2) & (BLOCK_TABLE_SIZE - 1))
+#define BLOCK_POOL_SIZE    (8 * 1024 * 1024)
+#define BLOCK_CODE_PAGES   (1 << (32 - MEM_PAGE_BITS))
+
+/*!
+ * superinstructions, pairs of instructions dispatched at once.
+ * second instruction of pair is kept in block for JIT and for
+ * counting retired instructions.
+ */
+typedef enum {
+    fuseLuiAddi,     // lui   rd, hi      ; addi rd', rd, lo
+    fuseAuipcAddi,   // auipc rd, hi      ; addi rd', rd, lo
+    fuseAuipcJalr,   // auipc rd, hi      ; jalr rd', rd, lo
+    fuseSlliAdd,     // slli  rd, rs, sh  ; add  rd', rd, rt
+    fuseCmpBranch,   // slt/sltu/slti rd  ; beqz/bnez rd
+    fuseTail
+} blockFusion;
+
+extern const char * const block_fusion_name[fuseTail];
+
+typedef struct {
+    const void  *label;     // dispatch target (direct threading)
+    instExecFunc exec;      // handler without trace, for instruction without fast path
+    instOperands operand;   // operands passed to exec
+    uint32_t     inst_idx;
+    Addr_t       pc;
+    Addr_t       next_pc;   // pc + 4, or pc + 2 for compressed instruction
+    RegAddr_t    rd;
+    RegAddr_t    rs1;
+    RegAddr_t    rs2;
+    Word_t       imm;
+} blockInst;
+
+typedef struct __block *block;
+struct __block {
+    Addr_t     pc;          // head address of block
+    uint32_t   len;         // number of guest instructions
+    Addr_t     succ_pc[2];  // chained successors: [0] taken, [1] fall-through
+    block      succ[2];
+    uint32_t   exec_count;  // number of executions, for JIT
+    void      *jit_code;    // translated host code, NULL if not translated
+    bool       breakpoint;  // head of block is breakpoint
+    blockInst  insts[];     // len instructions + exit entry
+};
+
+typedef struct __blockCache *blockCache;
+struct __blockCache {
+    block     table[BLOCK_TABLE_SIZE];   // lookup by head address
+    Byte_t   *pool;
+    size_t    pool_used;
+    bool      flushed;                   // set when blocks are thrown away
+    uint32_t  code_page[BLOCK_CODE_PAGES / 32];  // pages which have blocks
+
+    /* statistics */
+    UDWord_t  built;
+    UDWord_t  chained;
+    UDWord_t  flushes;
+    UDWord_t  fused[fuseTail];           // executions of superinstructions
+};
+
+
+blockCache CreateBlockCache (void);
+void       DestroyBlockCache (blockCache);
+void       FlushBlockCache (riscvEnv);
+void       InvalidateBlockCache (Addr_t, riscvEnv);
+void       ExecBlockSimulation (uint32_t, riscvEnv);
+bool       IsBlockTerminator (uint32_t);
@@ -0,0 +1,457 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <sys/stat.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "./env.h"
+#include "./dec_cache.h"
+#include "./block.h"
+#include "./simulation.h"
+#include "./checkpoint.h"
+
+// worst case of PackBits is one header per 128 literal bytes
+#define PACKED_PAGE_MAX  (MEM_PAGE_SIZE + MEM_PAGE_SIZE / 128)
+
+
+static bool IsZeroPage (const Byte_t *page)
+{
+    const UDWord_t *words = (const UDWord_t *)page;
+    UDWord_t        bits  = 0;
+    for (uint32_t i = 0; i < MEM_PAGE_SIZE / sizeof (UDWord_t); i++) {
+        bits |= words[i];
+    }
+    return bits == 0;
+}
+
+
+/*!
+ * compare two pages, by 64 bytes per iteration with SSE2
+ * \return  true if pages have same contents
+ */
+static bool IsSamePage (const Byte_t *a, const Byte_t *b)
+{
+#ifdef __SSE2__
+    for (uint32_t i = 0; i < MEM_PAGE_SIZE; i += 64) {
+        const __m128i *pa = (const __m128i *)(a + i);
+        const __m128i *pb = (const __m128i *)(b + i);
+        __m128i eq = _mm_and_si128 (_mm_and_si128 (_mm_cmpeq_epi8 (_mm_loadu_si128 (pa),     _mm_loadu_si128 (pb)),
+                                                   _mm_cmpeq_epi8 (_mm_loadu_si128 (pa + 1), _mm_loadu_si128 (pb + 1))),
+                                    _mm_and_si128 (_mm_cmpeq_epi8 (_mm_loadu_si128 (pa + 2), _mm_loadu_si128 (pb + 2)),
+                                                   _mm_cmpeq_epi8 (_mm_loadu_si128 (pa + 3), _mm_loadu_si128 (pb + 3))));
+        if (_mm_movemask_epi8 (eq) != 0xffff) {
+            return false;
+        }
+    }
+    return true;
+#else
+    return memcmp (a, b, MEM_PAGE_SIZE) == 0;
+#endif
+}
+
+
+/*!
+ * compress page by PackBits
+ * header byte h is followed by h + 1 literal bytes if h < 128,
+ * or by one byte repeated 257 - h times.
+ * \param dst  compressed data, PACKED_PAGE_MAX bytes at most
+ * \param src  page to be compressed
+ * \return     length of compressed data
+ */
+static uint32_t PackPage (Byte_t *dst, const Byte_t *src)
+{
+    uint32_t in = 0, out = 0;
+    while (in < MEM_PAGE_SIZE) {
+        uint32_t run = 1;
+        while (in + run < MEM_PAGE_SIZE && run < 128 && src[in + run] == src[in]) {
+            run++;
+        }
+        if (run >= 3) {
+            dst[out++] = 257 - run;
+            dst[out++] = src[in];
+            in += run;
+            continue;
+        }
+
+        // literals until next run of 3 bytes
+        uint32_t head = in;
+        while (in < MEM_PAGE_SIZE && in - head < 128) {
+            if (in + 2 < MEM_PAGE_SIZE && src[in] == src[in + 1] && src[in] == src[in + 2]) {
+                break;
+            }
+            in++;
+        }
+        dst[out++] = in - head - 1;
+        memcpy (dst + out, src + head, in - head);
+        out += in - head;
+    }
+    return out;
+}
+
+
+/*!
+ * expand page compressed by PackPage
+ * \param dst     page to be written
+ * \param src     compressed data
+ * \param length  length of compressed data
+ * \return        false if data does not make exactly one page
+ */
+static bool UnpackPage (Byte_t *dst, const Byte_t *src, uint32_t length)
+{
+    uint32_t in = 0, out = 0;
+    while (in < length) {
+        uint32_t h = src[in++];
+        if (h < 128) {
+            uint32_t n = h + 1;
+            if (in + n > length || out + n > MEM_PAGE_SIZE) {
+                return false;
+            }
+            memcpy (dst + out, src + in, n);
+            in  += n;
+            out += n;
+        } else {
+            uint32_t n = 257 - h;
+            if (in >= length || out + n > MEM_PAGE_SIZE) {
+                return false;
+            }
+            memset (dst + out, src[in++], n);
+            out += n;
+        }
+    }
+    return out == MEM_PAGE_SIZE;
+}
+
+
+/*!
+ * write checkpoint file
+ * \param filename    checkpoint file to be written
+ * \param compress    compress pages by run-length coding
+ * \param delta       pages are changes since last checkpoint
+ * \param pages       addresses of pages to be written
+ * \param page_count  number of pages
+ * \param env         environment
+ * \return            false if file cannot be written
+ */
+static bool WriteCheckpoint (const char *filename, bool compress, bool delta,
+                             const Addr_t *pages, uint32_t page_count, riscvEnv env)
+{
+    FILE *fp = fopen (filename, "wb");
+    if (fp == NULL) {
+        perror ("fopen");
+        return false;
+    }
+    setvbuf (fp, NULL, _IOFBF, 1 << 20);
+
+    checkpointHeader header;
+    memset (&header, 0, sizeof (header));
+    memcpy (header.magic, CHECKPOINT_MAGIC, sizeof (header.magic));
+    header.version    = CHECKPOINT_VERSION;
+    header.flags      = (compress ? CHECKPOINT_COMPRESS : 0) | (delta ? CHECKPOINT_DELTA : 0);
+    memcpy (header.regs, env->regs, sizeof (header.regs));
+    header.pc         = env->pc;
+    header.exit_code  = env->exit_code;
+    header.step       = env->step;
+    header.base_step  = delta ? env->ckpt_step : 0;
+    header.page_count = page_count;
+    fwrite (&header, sizeof (header), 1, fp);
+
+    Byte_t packed[PACKED_PAGE_MAX];
+    for (uint32_t i = 0; i < page_count; i++) {
+        const Byte_t  *page = GetMemPage (env->memory, pages[i], false);
+        checkpointPage record = {pages[i], MEM_PAGE_SIZE};
+        const Byte_t  *data = page;
+        if (page == NULL || IsZeroPage (page) == true) {
+            record.length = 0;
+        } else if (compress == true) {
+            uint32_t length = PackPage (packed, page);
+            if (length < MEM_PAGE_SIZE) {
+                record.length = length;
+                data = packed;
+            }
+        }
+        fwrite (&record, sizeof (record), 1, fp);
+        fwrite (data, 1, record.length, fp);
+    }
+
+    bool result = (ferror (fp) == 0);
+    if (fclose (fp) != 0 || result == false) {
+        fprintf (stderr, "<Checkpoint : failed to write %s>\n", filename);
+        return false;
+    }
+    return true;
+}
+
+
+/*!
+ * make current state the base of next delta checkpoint.
+ * paged memory keeps its pages shared with base, so that changed pages
+ * can be compared with their contents at checkpoint.
+ * \param env  environment
+ */
+static void SetCheckpointBase (riscvEnv env)
+{
+    if (env->ckpt_base != NULL) {
+        DestroyMemTable (env->ckpt_base);
+        env->ckpt_base = NULL;
+    }
+    if (env->memory->type == memTypePaged) {
+        env->ckpt_base = CloneMemTable (env->memory);
+    }
+    ClearDirtyPages (env);   // also drops write tags of pages shared with base
+    env->ckpt_step  = env->step;
+    env->ckpt_taken = true;
+}
+
+
+/*!
+ * save architecture state and touched guest pages
+ * \param filename  checkpoint file to be written
+ * \param compress  compress pages by run-length coding
+ * \param env       environment
+ * \return          false if file cannot be written
+ */
+bool SaveCheckpoint (const char *filename, bool compress, riscvEnv env)
+{
+    uint32_t page_count;
+    Addr_t  *pages  = ListTouchedPages (env, &page_count);
+    bool     result = WriteCheckpoint (filename, compress, false, pages, page_count, env);
+    free (pages);
+    if (result == true) {
+        SetCheckpointBase (env);
+    }
+    return result;
+}
+
+
+/*!
+ * save architecture state and pages changed since last checkpoint.
+ * dirty pages are compared with base, and rewritten with same contents are
+ * dropped. full checkpoint is saved if there is no base yet.
+ * \param filename  checkpoint file to be written
+ * \param compress  compress pages by run-length coding
+ * \param env       environment
+ * \return          false if file cannot be written
+ */
+bool SaveCheckpointDelta (const char *filename, bool compress, riscvEnv env)
+{
+    if (env->ckpt_taken == false) {
+        return SaveCheckpoint (filename, compress, env);
+    }
+
+    uint32_t page_count = 0, capacity = 64;
+    Addr_t  *pages = (Addr_t *) checked_malloc (sizeof (Addr_t) * capacity);
+    const uint64_t *dirty = env->memory->dirty;
+    for (uint32_t w = 0; w < MEM_DIRTY_WORDS; w++) {
+        for (uint64_t bits = dirty[w]; bits != 0; bits &= bits - 1) {
+            Addr_t addr = ((w * 64) + __builtin_ctzll (bits)) << MEM_PAGE_BITS;
+            if (env->ckpt_base != NULL) {
+                const Byte_t *page = GetMemPage (env->memory, addr, false);
+                const Byte_t *base = GetMemPage (env->ckpt_base, addr, false);
+                if (page == base ||
+                    (base != NULL && IsSamePage (page, base) == true) ||
+                    (base == NULL && IsZeroPage (page) == true)) {
+                    continue;
+                }
+            }
+            if (page_count == capacity) {
+                capacity *= 2;
+                pages = (Addr_t *) realloc (pages, sizeof (Addr_t) * capacity);
+                if (pages == NULL) {
+                    perror ("realloc");
+                    exit (EXIT_FAILURE);
+                }
+            }
+            pages[page_count++] = addr;
+        }
+    }
+
+    bool result = WriteCheckpoint (filename, compress, true, pages, page_count, env);
+    free (pages);
+    if (result == true) {
+        SetCheckpointBase (env);
+    }
+    return result;
+}
+
+
+/*!
+ * restore architecture state and guest pages.
+ * pages which are not in checkpoint are left untouched, so environment
+ * should be fresh or loaded with the same program image. delta checkpoint
+ * is restored after its base.
+ * \param filename  checkpoint file to be read
+ * \param env       environment
+ * \return          false if file is not a valid checkpoint
+ */
+bool LoadCheckpoint (const char *filename, riscvEnv env)
+{
+    FILE *fp = fopen (filename, "rb");
+    if (fp == NULL) {
+        perror ("fopen");
+        return false;
+    }
+    struct stat st;
+    if (fstat (fileno (fp), &st) != 0 || (size_t)st.st_size < sizeof (checkpointHeader)) {
+        fprintf (stderr, "<Checkpoint : %s is too short>\n", filename);
+        fclose (fp);
+        return false;
+    }
+    size_t size = st.st_size;
+    const Byte_t *image = (const Byte_t *) mmap (NULL, size, PROT_READ, MAP_PRIVATE, fileno (fp), 0);
+    fclose (fp);
+    if (image == MAP_FAILED) {
+        perror ("mmap");
+        return false;
+    }
+
+    bool result = false;
+    checkpointHeader header;
+    memcpy (&header, image, sizeof (header));
+    if (memcmp (header.magic, CHECKPOINT_MAGIC, sizeof (header.magic)) != 0 ||
+        header.version != CHECKPOINT_VERSION) {
+        fprintf (stderr, "<Checkpoint : %s is not a checkpoint of this version>\n", filename);
+        goto end;
+    }
+    if ((header.flags & CHECKPOINT_DELTA) &&
+        (env->ckpt_taken == false || env->ckpt_step != header.base_step)) {
+        fprintf (stderr, "<Checkpoint : %s should be restored on checkpoint at step %llu>\n",
+                 filename, (unsigned long long)header.base_step);
+        goto end;
+    }
+
+    size_t offset = sizeof (header);
+    for (uint32_t i = 0; i < header.page_count; i++) {
+        checkpointPage record;
+        if (offset + sizeof (record) > size) {
+            goto broken;
+        }
+        memcpy (&record, image + offset, sizeof (record));
+        offset += sizeof (record);
+        if (record.length > MEM_PAGE_SIZE || offset + record.length > size ||
+            (record.addr & MEM_PAGE_MASK) != 0) {
+            goto broken;
+        }
+
+        Byte_t *page = GetMemPage (env->memory, record.addr, true);
+        if (record.length == 0) {
+            memset (page, 0, MEM_PAGE_SIZE);
+        } else if (record.length == MEM_PAGE_SIZE) {
+            memcpy (page, image + offset, MEM_PAGE_SIZE);
+        } else if (UnpackPage (page, image + offset, record.length) == false) {
+            goto broken;
+        }
+        offset += record.length;
+    }
+
+    memcpy (env->regs, header.regs, sizeof (env->regs));
+    env->pc        = header.pc;
+    env->exit_code = header.exit_code;
+    env->step      = header.step;
+
+    // cached translations may refer to old memory contents
+    FlushTLB (env);
+    FlushDecCache (env);
+    FlushBlockCache (env);
+    SetCheckpointBase (env);
+    result = true;
+    goto end;
+
+broken:
+    fprintf (stderr, "<Checkpoint : %s is broken>\n", filename);
+end:
+    munmap ((void *)image, size);
+    return result;
+}
+
+
+/*!
+ * run simulation and write checkpoint every interval steps.
+ * <basename>.0 is full checkpoint of start state, and following
+ * <basename>.1, <basename>.2 ... are delta checkpoints.
+ * \param env       environment
+ * \param stop      stop conditions, max_steps and time_limit cover whole run
+ * \param interval  steps between checkpoints
+ * \param basename  head of checkpoint file names
+ * \param compress  compress pages by run-length coding
+ * \return          reason of stop
+ */
+stopReason RunSimulationWithCheckpoints (riscvEnv env, stopConditions *stop, UDWord_t interval,
+                                         const char *basename, bool compress)
+{
+    size_t   name_len = strlen (basename) + 24;
+    char    *filename = (char *) checked_malloc (name_len);
+    UDWord_t max_steps  = stop->max_steps;
+    double   time_limit = stop->time_limit;
+    double   deadline   = GetTime () + time_limit;
+    UDWord_t start      = env->step;
+    uint32_t index      = 0;
+    stopReason reason;
+
+    snprintf (filename, name_len, "%s.%u", basename, index++);
+    if (SaveCheckpoint (filename, compress, env) == false) {
+        exit (EXIT_FAILURE);
+    }
+
+    for (;;) {
+        UDWord_t executed = env->step - start;
+        stop->max_steps = interval;
+        if (max_steps != 0 && max_steps - executed < interval) {
+            stop->max_steps = max_steps - executed;
+        }
+        if (time_limit > 0.0) {
+            stop->time_limit = deadline - GetTime ();
+            if (stop->time_limit <= 0.0) {
+                reason = env->stop_reason = stopTimeLimit;
+                break;
+            }
+        }
+
+        reason = RunSimulation (env, stop);
+        if (reason != stopBudget || (max_steps != 0 && env->step - start >= max_steps)) {
+            break;
+        }
+        snprintf (filename, name_len, "%s.%u", basename, index++);
+        if (SaveCheckpointDelta (filename, compress, env) == false) {
+            exit (EXIT_FAILURE);
+        }
+    }
+
+    stop->max_steps  = max_steps;
+    stop->time_limit = time_limit;
+    free (filename);
+    return reason;
+}
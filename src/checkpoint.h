@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#pragma once
+
+#include <stdbool.h>
+#include "./env.h"
+
+/*!
+ * Checkpoint file
+ * header, followed by records of touched pages in address order.
+ * delta checkpoint has only pages changed since the checkpoint at base_step,
+ * and is restored on top of it.
+ * each page record is checkpointPage and its data. data length is
+ *   0             : page is filled with zero
+ *   MEM_PAGE_SIZE : raw page
+ *   others        : page compressed by PackBits run-length coding
+ * values are stored in host byte order.
+ */
+#define CHECKPOINT_MAGIC    "SWCKPT\0"
+#define CHECKPOINT_VERSION  2
+
+#define CHECKPOINT_COMPRESS  0x01
+#define CHECKPOINT_DELTA     0x02
+
+typedef struct {
+    char     magic[8];
+    uint32_t version;
+    uint32_t flags;
+    Word_t   regs[32];
+    Addr_t   pc;
+    Word_t   exit_code;
+    UDWord_t step;
+    UDWord_t base_step;   // step of base checkpoint (delta only)
+    uint32_t page_count;
+    uint32_t reserved;
+} checkpointHeader;
+
+typedef struct {
+    Addr_t   addr;     // head of guest page
+    uint32_t length;   // length of data
+} checkpointPage;
+
+bool SaveCheckpoint (const char *filename, bool compress, riscvEnv env);
+bool SaveCheckpointDelta (const char *filename, bool compress, riscvEnv env);
+bool LoadCheckpoint (const char *filename, riscvEnv env);
+stopReason RunSimulationWithCheckpoints (riscvEnv env, stopConditions *stop, UDWord_t interval,
+                                         const char *basename, bool compress);
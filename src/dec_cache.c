@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "./env.h"
+#include "./dec_cache.h"
+#include "./inst_decoder.h"
+
+extern void (* const inst_exec_func[])(const instOperands *, riscvEnv);
+extern void (* const inst_exec_func_notrace[])(const instOperands *, riscvEnv);
+
+static void SetInstFields (decodedInst *inst, instOperandFormat format);
+
+
+/*!
+ * create pre-decoded instruction cache
+ * \return cache array, all entries are invalid
+ */
+decodedInst *CreateDecCache (void)
+{
+    decodedInst *cache = (decodedInst *) checked_malloc (sizeof (decodedInst) * DEC_CACHE_SIZE);
+    int i;
+    for (i = 0; i < DEC_CACHE_SIZE; i++) {
+        cache[i].pc = DEC_CACHE_INVALID;
+    }
+    return cache;
+}
+
+
+/*!
+ * fetch and decode instruction, or get it from cache
+ * \param pc   address of instruction
+ * \param env  RISC-V environment
+ * \return     decoded instruction (inst_idx is -1 if illegal)
+ */
+decodedInst *FetchDecodedInst (Addr_t pc, riscvEnv env)
+{
+    decodedInst *inst = &env->dec_cache[DEC_CACHE_INDEX (pc)];
+    if (inst->pc == pc) {
+        env->dec_hit++;
+        return inst;
+    }
+
+    env->dec_miss++;
+    DecodeInst (inst, pc, FetchMemory (pc, env), env);
+    return inst;
+}
+
+
+/*!
+ * decode instruction into decoded form
+ * \param inst  decoded instruction to be filled
+ * \param pc    address of instruction
+ * \param hex   instruction word fetched at pc, upper half is ignored if compressed
+ * \param env   RISC-V environment
+ */
+void DecodeInst (decodedInst *inst, Addr_t pc, Word_t hex, riscvEnv env)
+{
+    inst->pc = pc;
+    if ((hex & 0x03) != 0x03) {
+        /* compressed instruction is executed by handler of its 32-bit form */
+        inst->inst_hex = hex & 0xffff;
+        inst->inst_len = 2;
+        hex = RISCV_EXPAND_RVC (inst->inst_hex);
+    } else {
+        inst->inst_hex = hex;
+        inst->inst_len = 4;
+    }
+    inst->inst_idx = RISCV_DEC (hex);
+    inst->exec     = (inst->inst_idx == -1) ? NULL : inst_exec_func[inst->inst_idx];
+    inst->exec_notrace = (inst->inst_idx == -1) ? NULL : inst_exec_func_notrace[inst->inst_idx];
+    inst->breakpoint = IsBreakpoint (pc, env);
+    SetInstFields (inst, DecodeInstOperands (inst->inst_idx, hex, &inst->operand));
+}
+
+
+/*!
+ * decode instruction into cache before it is fetched
+ * \param pc   address of instruction
+ * \param hex  instruction word at pc, upper half is ignored if compressed
+ * \param env  RISC-V environment
+ */
+void PreloadDecCache (Addr_t pc, Word_t hex, riscvEnv env)
+{
+    DecodeInst (&env->dec_cache[DEC_CACHE_INDEX (pc)], pc, hex, env);
+}
+
+
+/*!
+ * invalidate cached instruction which is overwritten by store
+ * instructions are halfword aligned, and a store of up to one word
+ * may overlap ones which start 2 bytes before and after it.
+ * \param addr  address of stored data
+ * \param env   RISC-V environment
+ */
+void InvalidateDecCache (Addr_t addr, riscvEnv env)
+{
+    Addr_t pc;
+    for (pc = (addr & ~0x01) - 2; pc != (addr & ~0x01) + 4; pc += 2) {
+        decodedInst *inst = &env->dec_cache[DEC_CACHE_INDEX (pc)];
+        if (inst->pc == pc) {
+            inst->pc = DEC_CACHE_INVALID;
+        }
+    }
+}
+
+
+/*!
+ * invalidate all cached instructions (FENCE.I)
+ * \param env   RISC-V environment
+ */
+void FlushDecCache (riscvEnv env)
+{
+    int i;
+    for (i = 0; i < DEC_CACHE_SIZE; i++) {
+        env->dec_cache[i].pc = DEC_CACHE_INVALID;
+    }
+}
+
+
+/*!
+ * copy register fields and immediate from operands
+ * fields which the format does not have are 0, and rs2 of I-type is
+ * the shift amount like the raw field.
+ * \param format  format of inst->operand
+ */
+static void SetInstFields (decodedInst *inst, instOperandFormat format)
+{
+    const instOperands *op = &inst->operand;
+    inst->rd  = 0;
+    inst->rs1 = 0;
+    inst->rs2 = 0;
+    inst->imm = 0;
+
+    switch (format) {
+    case instOperandRFormat :
+        inst->rd  = op->r.rd;
+        inst->rs1 = op->r.rs1;
+        inst->rs2 = op->r.rs2;
+        break;
+    case instOperandR4Format :
+        inst->rd  = op->r4.rd;
+        inst->rs1 = op->r4.rs1;
+        inst->rs2 = op->r4.rs2;
+        break;
+    case instOperandIFormat :
+        inst->rd  = op->i.rd;
+        inst->rs1 = op->i.rs1;
+        inst->rs2 = op->i.imm & 0x1f;   // shamt of immediate shifts
+        inst->imm = op->i.imm;
+        break;
+    case instOperandSFormat :
+        inst->rs1 = op->s.rs1;
+        inst->rs2 = op->s.rs2;
+        inst->imm = op->s.imm;
+        break;
+    case instOperandSBFormat :
+        inst->rs1 = op->sb.rs1;
+        inst->rs2 = op->sb.rs2;
+        inst->imm = op->sb.imm;
+        break;
+    case instOperandUFormat :
+        inst->rd  = op->u.rd;
+        inst->imm = op->u.imm;
+        break;
+    case instOperandUJFormat :
+        inst->rd  = op->uj.rd;
+        inst->imm = op->uj.imm;
+        break;
+    case instOperandNone :
+        break;
+    }
+}
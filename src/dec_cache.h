@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "./basic.h"
+#include "./inst_format.h"
+
+typedef struct __riscvEnv *riscvEnv;
+
+/*!
+ * Pre-decoded instruction cache
+ * direct-mapped cache indexed by guest PC. each entry keeps result of
+ * RISCV_DEC, handler and operand fields extracted at decode time.
+ * compressed instruction is expanded into 32-bit form before decoding,
+ * so it costs nothing more than 32-bit one once it is cached.
+ */
+#define DEC_CACHE_BITS    14
+#define DEC_CACHE_SIZE    (1 << DEC_CACHE_BITS)
+#define DEC_CACHE_INVALID 0x00000001   // odd PC never matches
+/* halfword aligned PC goes to the upper half, not to the next word */
+#define DEC_CACHE_INDEX(pc) ((((pc) >> 2) | (((pc) & 0x02) << (DEC_CACHE_BITS - 2))) & (DEC_CACHE_SIZE - 1))
+
+typedef void (*instExecFunc) (const instOperands *, riscvEnv);
+
+typedef struct {
+    Addr_t       pc;         // tag
+    Word_t       inst_hex;   // raw instruction, lower 16 bits for compressed one
+    uint32_t     inst_len;   // 4, or 2 for compressed instruction
+    uint32_t     inst_idx;   // result of RISCV_DEC, -1 if illegal
+    instExecFunc exec;       // handler of instruction
+    instExecFunc exec_notrace;  // handler without trace recording
+    bool         breakpoint; // stop before this instruction
+    instOperands operand;    // operands passed to handler
+
+    RegAddr_t    rd;
+    RegAddr_t    rs1;
+    RegAddr_t    rs2;
+    Word_t       imm;        // immediate, sign extended per instruction format
+} decodedInst;
+
+
+decodedInst *CreateDecCache (void);
+decodedInst *FetchDecodedInst (Addr_t, riscvEnv);
+void         DecodeInst (decodedInst *, Addr_t, Word_t, riscvEnv);
+void         PreloadDecCache (Addr_t, Word_t, riscvEnv);
+void         InvalidateDecCache (Addr_t, riscvEnv);
+void         FlushDecCache (riscvEnv);
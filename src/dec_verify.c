@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include "./inst_decoder.h"
+#include "./inst_pattern.h"
+
+/*!
+ * Exhaustive check of RISCV_DEC against a reference decoder which
+ * matches the raw bit patterns of riscv_arch_table.rb one by one.
+ */
+
+#define DEC_ILLEGAL_IDX  (INST_PATTERN_NUM)   // row/column for illegal words
+#define DEC_RESULT_NUM   (INST_PATTERN_NUM + 1)
+
+typedef struct {
+    uint64_t count;
+    uint32_t example;   // first word found
+} decStat;
+
+typedef struct {
+    pthread_t  thread;
+    uint32_t   id;
+    uint64_t   start;
+    uint64_t   end;     // exclusive
+    double     dec_sec;
+    double     ref_sec;
+    uint32_t   sink;
+    decStat    mismatch[DEC_RESULT_NUM][DEC_RESULT_NUM];     // [RISCV_DEC][reference]
+    decStat    overlap[INST_PATTERN_NUM][INST_PATTERN_NUM];  // [first match][other match]
+} verifyWorker;
+
+static void usage (FILE *);
+
+
+static double GetSeconds (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static inline void CountStat (decStat *stat, uint32_t word)
+{
+    if (stat->count++ == 0) {
+        stat->example = word;
+    }
+}
+
+
+/*!
+ * slow reference decoder: first pattern which matches the word,
+ * every other matching pattern is recorded as an overlap.
+ */
+static uint32_t RefDecode (uint32_t word, verifyWorker *worker)
+{
+    uint32_t result = DEC_ILLEGAL_IDX;
+    for (uint32_t idx = 0; idx < INST_PATTERN_NUM; idx++) {
+        if ((word & inst_pattern[idx].mask) != inst_pattern[idx].match) {
+            continue;
+        }
+        if (result == DEC_ILLEGAL_IDX) {
+            result = idx;
+        } else {
+            CountStat (&worker->overlap[result][idx], word);
+        }
+    }
+    return result;
+}
+
+
+static void *VerifyWorker (void *arg)
+{
+    verifyWorker *worker = (verifyWorker *)arg;
+    uint32_t sink = 0;
+    double   begin;
+
+    // decoder throughput alone
+    begin = GetSeconds ();
+    for (uint64_t word = worker->start; word < worker->end; word++) {
+        sink += RISCV_DEC ((uint32_t)word);
+    }
+    worker->dec_sec = GetSeconds () - begin;
+    worker->sink = sink;
+
+    begin = GetSeconds ();
+    for (uint64_t word = worker->start; word < worker->end; word++) {
+        uint32_t dec = RISCV_DEC ((uint32_t)word);
+        uint32_t ref = RefDecode ((uint32_t)word, worker);
+        if (dec >= INST_PATTERN_NUM) {
+            dec = DEC_ILLEGAL_IDX;
+        }
+        if (dec != ref) {
+            CountStat (&worker->mismatch[dec][ref], (uint32_t)word);
+        }
+    }
+    worker->ref_sec = GetSeconds () - begin;
+
+    return NULL;
+}
+
+
+static const char *ResultName (uint32_t idx)
+{
+    return idx == DEC_ILLEGAL_IDX ? "(illegal)" : inst_pattern[idx].name;
+}
+
+
+int main (int argc, char *argv[])
+{
+    uint64_t start = 0;
+    uint64_t end   = 1ULL << 32;
+    long     nthreads = sysconf (_SC_NPROCESSORS_ONLN);
+
+    /*!
+     * variables for getopt
+     */
+    int     ch;
+    extern char *optarg;
+    extern int  optind, opterr;
+
+    while ((ch = getopt(argc, argv, "t:s:e:")) != -1){
+        switch (ch){
+        case 't':  // number of threads
+            nthreads = strtol (optarg, NULL, 0);
+            break;
+        case 's':  // first word
+            start = strtoull (optarg, NULL, 16);
+            break;
+        case 'e':  // end of range (exclusive)
+            end = strtoull (optarg, NULL, 16);
+            break;
+        default:
+            usage (stderr);
+            exit (EXIT_FAILURE);
+        }
+    }
+    if (nthreads < 1) {
+        nthreads = 1;
+    }
+    if (end > (1ULL << 32) || start >= end) {
+        usage (stderr);
+        exit (EXIT_FAILURE);
+    }
+
+    verifyWorker *workers = (verifyWorker *)calloc (nthreads, sizeof(verifyWorker));
+    if (workers == NULL) {
+        perror ("calloc");
+        exit (EXIT_FAILURE);
+    }
+
+    fprintf (stdout, "<Verify RISCV_DEC : %08llx - %08llx, %ld threads>\n",
+             (unsigned long long)start, (unsigned long long)(end - 1), nthreads);
+
+    uint64_t chunk = (end - start + nthreads - 1) / nthreads;
+    for (long t = 0; t < nthreads; t++) {
+        workers[t].id    = t;
+        workers[t].start = start + chunk * t < end ? start + chunk * t : end;
+        workers[t].end   = workers[t].start + chunk < end ? workers[t].start + chunk : end;
+        if (pthread_create (&workers[t].thread, NULL, VerifyWorker, &workers[t]) != 0) {
+            perror ("pthread_create");
+            exit (EXIT_FAILURE);
+        }
+    }
+    for (long t = 0; t < nthreads; t++) {
+        pthread_join (workers[t].thread, NULL);
+    }
+
+    // throughput
+    for (long t = 0; t < nthreads; t++) {
+        double words = (double)(workers[t].end - workers[t].start);
+        fprintf (stdout, "thread %2ld : %10llu words, RISCV_DEC %8.2f Mwords/sec, reference %8.2f Mwords/sec\n",
+                 t, (unsigned long long)(workers[t].end - workers[t].start),
+                 workers[t].dec_sec > 0 ? words / workers[t].dec_sec / 1e6 : 0.0,
+                 workers[t].ref_sec > 0 ? words / workers[t].ref_sec / 1e6 : 0.0);
+    }
+
+    // merge the results of all threads, keeping the lowest example word
+    for (long t = 1; t < nthreads; t++) {
+        for (uint32_t i = 0; i < DEC_RESULT_NUM; i++) {
+            for (uint32_t j = 0; j < DEC_RESULT_NUM; j++) {
+                if (workers[0].mismatch[i][j].count == 0) {
+                    workers[0].mismatch[i][j].example = workers[t].mismatch[i][j].example;
+                }
+                workers[0].mismatch[i][j].count += workers[t].mismatch[i][j].count;
+            }
+        }
+        for (uint32_t i = 0; i < INST_PATTERN_NUM; i++) {
+            for (uint32_t j = 0; j < INST_PATTERN_NUM; j++) {
+                if (workers[0].overlap[i][j].count == 0) {
+                    workers[0].overlap[i][j].example = workers[t].overlap[i][j].example;
+                }
+                workers[0].overlap[i][j].count += workers[t].overlap[i][j].count;
+            }
+        }
+    }
+
+    uint64_t mismatch_words = 0;
+    fprintf (stdout, "<Mismatches : RISCV_DEC / reference>\n");
+    for (uint32_t i = 0; i < DEC_RESULT_NUM; i++) {
+        for (uint32_t j = 0; j < DEC_RESULT_NUM; j++) {
+            decStat *stat = &workers[0].mismatch[i][j];
+            if (stat->count != 0) {
+                fprintf (stdout, "  %-12s / %-12s : %10llu words, e.g. %08x\n",
+                         ResultName (i), ResultName (j), (unsigned long long)stat->count, stat->example);
+                mismatch_words += stat->count;
+            }
+        }
+    }
+
+    uint64_t overlap_pairs = 0;
+    fprintf (stdout, "<Overlaps : first match / other match>\n");
+    for (uint32_t i = 0; i < INST_PATTERN_NUM; i++) {
+        for (uint32_t j = 0; j < INST_PATTERN_NUM; j++) {
+            decStat *stat = &workers[0].overlap[i][j];
+            if (stat->count != 0) {
+                fprintf (stdout, "  %-12s / %-12s : %10llu words, e.g. %08x\n",
+                         ResultName (i), ResultName (j), (unsigned long long)stat->count, stat->example);
+                overlap_pairs++;
+            }
+        }
+    }
+
+    fprintf (stdout, "<Result : %llu mismatched words, %llu overlapping pattern pairs>\n",
+             (unsigned long long)mismatch_words, (unsigned long long)overlap_pairs);
+
+    free (workers);
+    return mismatch_words == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+static void usage (FILE *fp)
+{
+    fprintf (fp, "usage: swimmer_decverify [-t threads] [-s first] [-e end]\n");
+    fprintf (fp, "  checks RISCV_DEC against the bit patterns of riscv_arch_table.rb\n");
+    fprintf (fp, "  -t : number of threads (default: number of cores)\n");
+    fprintf (fp, "  -s : first instruction word in hex (default: 0)\n");
+    fprintf (fp, "  -e : end of the range in hex, exclusive (default: 100000000)\n");
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "./env.h"
+#include "./inst_decoder.h"
+#include "./inst_print.h"
+#include "./disasm.h"
+
+typedef struct {
+    Addr_t      start;
+    uint32_t    size;         // bytes of instructions which start in chunk
+    uint32_t    insts;        // number of instructions
+    bool        range_head;   // first chunk of a loaded range
+    uint32_t    range_size;   // size of range, for range_head
+    char       *text;
+    size_t      length;
+    bool        done;         // guarded by lock of job
+} disasmChunk;
+
+typedef struct {
+    riscvEnv     env;
+    disasmChunk *chunks;
+    uint32_t     chunk_count;
+    uint32_t     window;      // max chunks formatted ahead of writer
+    atomic_uint  next;        // next chunk to be formatted
+    uint32_t     written;     // chunks written by main thread, guarded by lock
+
+    pthread_mutex_t lock;
+    pthread_cond_t  done;     // signalled when chunk is formatted
+    pthread_cond_t  space;    // signalled when written is advanced
+} disasmJob;
+
+
+static int CompareLoadRange (const void *a, const void *b)
+{
+    Addr_t sa = ((const loadRange *)a)->start;
+    Addr_t sb = ((const loadRange *)b)->start;
+    return (sa > sb) - (sa < sb);
+}
+
+
+/*!
+ * sort loaded ranges and merge overlapping ones, aligned to halfword
+ * \return number of ranges in ranges
+ */
+static uint32_t MergeLoadRanges (loadRange *ranges, riscvEnv env)
+{
+    uint32_t count = 0;
+    uint32_t i;
+
+    memcpy (ranges, env->load_ranges, sizeof (loadRange) * env->load_range_count);
+    qsort (ranges, env->load_range_count, sizeof (loadRange), CompareLoadRange);
+
+    for (i = 0; i < env->load_range_count; i++) {
+        UDWord_t start = ranges[i].start & ~0x01;
+        UDWord_t end   = ((UDWord_t)ranges[i].start + ranges[i].size + 1) & ~0x01ULL;
+        if (count > 0 && start <= (UDWord_t)ranges[count - 1].start + ranges[count - 1].size) {
+            UDWord_t last_end = (UDWord_t)ranges[count - 1].start + ranges[count - 1].size;
+            if (end > last_end) {
+                ranges[count - 1].size = end - ranges[count - 1].start;
+            }
+            continue;
+        }
+        ranges[count].start = start;
+        ranges[count].size  = end - start;
+        count++;
+    }
+    return count;
+}
+
+
+/*!
+ * read instruction of program image, upper half is read only if lower
+ * one is not compressed instruction.
+ * memory is read only, page tables are not modified while disassembling.
+ */
+static Word_t ReadImageInst (Addr_t addr, riscvEnv env)
+{
+    HWord_t half[2] = { 0, 0 };
+    uint32_t i;
+
+    for (i = 0; i < 2; i++, addr += 2) {
+        Byte_t *page = GetMemPage (env->memory, addr, false);
+        if (page != NULL) {
+            memcpy (&half[i], &page[addr & MEM_PAGE_MASK], sizeof (half[i]));
+        }
+        if ((half[0] & 0x03) != 0x03) {
+            break;
+        }
+    }
+    return ((Word_t)half[1] << 16) | half[0];
+}
+
+
+static void FormatChunk (disasmChunk *chunk, riscvEnv env)
+{
+    char    *p    = chunk->text;
+    uint32_t offset;
+
+    if (chunk->range_head) {
+        p += sprintf (p, "<Load range: %08x - %08x>\n", chunk->start,
+                      (Addr_t)(chunk->start + chunk->range_size - 1));
+    }
+    for (offset = 0; offset < chunk->size; ) {
+        Addr_t   addr     = chunk->start + offset;
+        Word_t   inst_hex = ReadImageInst (addr, env);
+        uint32_t inst_idx;
+        if ((inst_hex & 0x03) != 0x03) {
+            inst_idx = RISCV_DEC (RISCV_EXPAND_RVC (inst_hex));
+            offset += 2;
+        } else {
+            inst_idx = RISCV_DEC (inst_hex);
+            offset += 4;
+        }
+        p += FormatDisasmLine (p, addr, inst_hex, inst_idx);
+    }
+    chunk->length = p - chunk->text;
+}
+
+
+static void *DisasmWorker (void *arg)
+{
+    disasmJob *job = (disasmJob *)arg;
+
+    for (;;) {
+        uint32_t id = atomic_fetch_add (&job->next, 1);
+        if (id >= job->chunk_count) {
+            break;
+        }
+        /* keep memory of pending text bounded */
+        pthread_mutex_lock (&job->lock);
+        while (id >= job->written + job->window) {
+            pthread_cond_wait (&job->space, &job->lock);
+        }
+        pthread_mutex_unlock (&job->lock);
+
+        disasmChunk *chunk = &job->chunks[id];
+        chunk->text = (char *) checked_malloc (64 + (size_t)chunk->insts * DISASM_LINE_MAX);
+        FormatChunk (chunk, job->env);
+
+        pthread_mutex_lock (&job->lock);
+        chunk->done = true;
+        pthread_cond_signal (&job->done);
+        pthread_mutex_unlock (&job->lock);
+    }
+    return NULL;
+}
+
+
+/*!
+ * disassemble all loaded words of program image
+ * \param fp       output file
+ * \param env      environment with loaded image
+ * \param threads  number of formatter threads
+ */
+void DisassembleImage (FILE *fp, riscvEnv env, uint32_t threads)
+{
+    disasmJob job;
+    uint32_t  i;
+
+    if (threads < 1) {
+        threads = 1;
+    }
+    if (threads > DISASM_MAX_THREADS) {
+        threads = DISASM_MAX_THREADS;
+    }
+
+    loadRange *ranges = (loadRange *) checked_malloc (sizeof (loadRange) * (env->load_range_count + 1));
+    uint32_t range_count = MergeLoadRanges (ranges, env);
+
+    /*
+     * split ranges into chunks. instruction length is decided by its
+     * lowest bits, so boundaries are found by walking each range once.
+     */
+    uint32_t capacity = 16;
+    job.chunk_count = 0;
+    job.chunks = (disasmChunk *) checked_malloc (sizeof (disasmChunk) * capacity);
+    for (i = 0; i < range_count; i++) {
+        uint32_t offset = 0;
+        while (offset < ranges[i].size) {
+            if (job.chunk_count == capacity) {
+                capacity *= 2;
+                job.chunks = (disasmChunk *) realloc (job.chunks, sizeof (disasmChunk) * capacity);
+                if (job.chunks == NULL) {
+                    perror ("realloc");
+                    exit (EXIT_FAILURE);
+                }
+            }
+            disasmChunk *chunk = &job.chunks[job.chunk_count++];
+            chunk->start      = ranges[i].start + offset;
+            chunk->insts      = 0;
+            chunk->range_head = (offset == 0);
+            chunk->range_size = ranges[i].size;
+            chunk->text       = NULL;
+            chunk->length     = 0;
+            chunk->done       = false;
+            uint32_t chunk_offset = offset;
+            while (offset < ranges[i].size && offset - chunk_offset < DISASM_CHUNK_BYTES) {
+                HWord_t half = ReadImageInst (ranges[i].start + offset, env) & 0xffff;
+                offset += ((half & 0x03) == 0x03) ? 4 : 2;
+                chunk->insts++;
+            }
+            chunk->size = offset - chunk_offset;
+        }
+    }
+    free (ranges);
+
+    job.env    = env;
+    job.window = threads * 4;
+    job.written = 0;
+    atomic_init (&job.next, 0);
+    pthread_mutex_init (&job.lock, NULL);
+    pthread_cond_init (&job.done, NULL);
+    pthread_cond_init (&job.space, NULL);
+
+    pthread_t thread[DISASM_MAX_THREADS];
+    for (i = 0; i < threads; i++) {
+        if (pthread_create (&thread[i], NULL, DisasmWorker, &job) != 0) {
+            perror ("pthread_create");
+            exit (EXIT_FAILURE);
+        }
+    }
+
+    /* write chunks in address order */
+    for (i = 0; i < job.chunk_count; i++) {
+        disasmChunk *chunk = &job.chunks[i];
+        pthread_mutex_lock (&job.lock);
+        while (chunk->done == false) {
+            pthread_cond_wait (&job.done, &job.lock);
+        }
+        pthread_mutex_unlock (&job.lock);
+
+        fwrite (chunk->text, 1, chunk->length, fp);
+        free (chunk->text);
+
+        pthread_mutex_lock (&job.lock);
+        job.written = i + 1;
+        pthread_cond_broadcast (&job.space);
+        pthread_mutex_unlock (&job.lock);
+    }
+
+    for (i = 0; i < threads; i++) {
+        pthread_join (thread[i], NULL);
+    }
+    pthread_cond_destroy (&job.space);
+    pthread_cond_destroy (&job.done);
+    pthread_mutex_destroy (&job.lock);
+    free (job.chunks);
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <elf.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "./env.h"
+#include "./elf_loader.h"
+
+#ifndef EM_RISCV
+#define EM_RISCV 243
+#endif
+
+
+/*!
+ * check magic number of ELF, file position is not moved
+ * only the first character is peeked if it is not ELF, so that
+ * s-record can be read from pipe.
+ * \param fp  file pointer to be checked
+ * \return    true if file starts with ELF magic
+ */
+bool IsElfImage (FILE *fp)
+{
+    int c = getc (fp);
+    if (c == EOF) {
+        return false;
+    }
+    ungetc (c, fp);
+    if (c != ELFMAG0) {
+        return false;
+    }
+
+    unsigned char ident[SELFMAG];
+    long pos = ftell (fp);
+    size_t len = fread (ident, 1, SELFMAG, fp);
+    fseek (fp, pos, SEEK_SET);
+    return len == SELFMAG && memcmp (ident, ELFMAG, SELFMAG) == 0;
+}
+
+
+/*!
+ * place file contents of segment into guest memory.
+ * with mmap backend, whole pages whose offset in file matches guest address
+ * are mapped from file as private pages, and copied on first write by kernel.
+ * other parts are copied.
+ * \param image   head of mapped ELF file
+ * \param fd      file descriptor of ELF file
+ * \param addr    guest address of segment
+ * \param offset  file offset of segment
+ * \param size    size of file contents
+ * \param env     environment
+ */
+static void LoadSegment (const Byte_t *image, int fd, Addr_t addr, uint32_t offset,
+                         uint32_t size, riscvEnv env)
+{
+    if (env->memory->type == memTypeMmap &&
+        (addr & MEM_PAGE_MASK) == (offset & MEM_PAGE_MASK) &&
+        sysconf (_SC_PAGESIZE) == MEM_PAGE_SIZE) {
+        uint32_t head = (MEM_PAGE_SIZE - (addr & MEM_PAGE_MASK)) & MEM_PAGE_MASK;
+        if (head < size) {
+            uint32_t body = (size - head) & ~MEM_PAGE_MASK;
+            if (body > 0 &&
+                mmap (env->memory->base + addr + head, body, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_FIXED, fd, offset + head) != MAP_FAILED) {
+                WriteMemoryImage (addr, image + offset, head, env);
+                WriteMemoryImage (addr + head + body, image + offset + head + body,
+                                  size - head - body, env);
+                return;
+            }
+        }
+    }
+    WriteMemoryImage (addr, image + offset, size, env);
+}
+
+
+static int CompareSymbol (const void *a, const void *b)
+{
+    const guestSymbol *sa = (const guestSymbol *)a;
+    const guestSymbol *sb = (const guestSymbol *)b;
+    if (sa->addr != sb->addr) {
+        return sa->addr < sb->addr ? -1 : 1;
+    }
+    return strcmp (sa->name, sb->name);
+}
+
+
+/*!
+ * keep function and object symbols of SHT_SYMTAB in environment
+ * section symbols, file symbols, undefined symbols and mapping symbols ($x, $d)
+ * are dropped.
+ * \param image  head of mapped ELF file
+ * \param size   size of ELF file
+ * \param env    environment
+ */
+static void LoadElfSymbols (const Byte_t *image, size_t size, riscvEnv env)
+{
+    const Elf32_Ehdr *ehdr = (const Elf32_Ehdr *)image;
+    if (ehdr->e_shoff == 0 || ehdr->e_shentsize != sizeof (Elf32_Shdr) ||
+        ehdr->e_shoff + (size_t)ehdr->e_shnum * sizeof (Elf32_Shdr) > size) {
+        return;
+    }
+    const Elf32_Shdr *shdr = (const Elf32_Shdr *)(image + ehdr->e_shoff);
+
+    for (int i = 0; i < ehdr->e_shnum; i++) {
+        if (shdr[i].sh_type != SHT_SYMTAB || shdr[i].sh_link >= ehdr->e_shnum) {
+            continue;
+        }
+        const Elf32_Shdr *symtab = &shdr[i];
+        const Elf32_Shdr *strtab = &shdr[symtab->sh_link];
+        if (symtab->sh_offset + (size_t)symtab->sh_size > size ||
+            strtab->sh_offset + (size_t)strtab->sh_size > size ||
+            strtab->sh_size == 0 || image[strtab->sh_offset + strtab->sh_size - 1] != '\0') {
+            fprintf (stderr, "<Loading ELF File : broken symbol table is ignored>\n");
+            return;
+        }
+
+        // names are referred from copy of string table
+        char *names = (char *) checked_malloc (strtab->sh_size);
+        memcpy (names, image + strtab->sh_offset, strtab->sh_size);
+
+        const Elf32_Sym *syms = (const Elf32_Sym *)(image + symtab->sh_offset);
+        uint32_t count = symtab->sh_size / sizeof (Elf32_Sym);
+        env->symbols = (guestSymbol *) checked_malloc (sizeof (guestSymbol) * (count + 1));
+        env->symbol_names = names;
+        env->symbol_count = 0;
+        for (uint32_t s = 0; s < count; s++) {
+            uint32_t type = ELF32_ST_TYPE (syms[s].st_info);
+            if (syms[s].st_shndx == SHN_UNDEF || syms[s].st_name == 0 ||
+                syms[s].st_name >= strtab->sh_size ||
+                type == STT_SECTION || type == STT_FILE ||
+                names[syms[s].st_name] == '$') {
+                continue;
+            }
+            guestSymbol *sym = &env->symbols[env->symbol_count++];
+            sym->addr = syms[s].st_value;
+            sym->size = syms[s].st_size;
+            sym->name = names + syms[s].st_name;
+        }
+        qsort (env->symbols, env->symbol_count, sizeof (guestSymbol), CompareSymbol);
+        return;
+    }
+}
+
+
+/*!
+ * load ELF32 executable for RISC-V
+ * \param fp   file pointer to be loaded ELF
+ * \param env  environment to be load
+ * \return     false if file is not loadable
+ */
+bool LoadElf (FILE *fp, riscvEnv env)
+{
+    int fd = fileno (fp);
+    struct stat st;
+    if (fstat (fd, &st) != 0) {
+        perror ("fstat");
+        return false;
+    }
+    size_t size = st.st_size;
+    if (size < sizeof (Elf32_Ehdr)) {
+        fprintf (stderr, "<Loading ELF File : file is too short>\n");
+        return false;
+    }
+
+    const Byte_t *image = (const Byte_t *) mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (image == MAP_FAILED) {
+        perror ("mmap");
+        return false;
+    }
+
+    bool result = false;
+    const Elf32_Ehdr *ehdr = (const Elf32_Ehdr *)image;
+    if (memcmp (ehdr->e_ident, ELFMAG, SELFMAG) != 0 ||
+        ehdr->e_ident[EI_CLASS] != ELFCLASS32 ||
+        ehdr->e_ident[EI_DATA]  != ELFDATA2LSB) {
+        fprintf (stderr, "<Loading ELF File : not a little-endian ELF32 file>\n");
+        goto end;
+    }
+    if (ehdr->e_type != ET_EXEC || ehdr->e_machine != EM_RISCV) {
+        fprintf (stderr, "<Loading ELF File : not a RISC-V executable>\n");
+        goto end;
+    }
+    if (ehdr->e_phentsize != sizeof (Elf32_Phdr) ||
+        ehdr->e_phoff + (size_t)ehdr->e_phnum * sizeof (Elf32_Phdr) > size) {
+        fprintf (stderr, "<Loading ELF File : program header is broken>\n");
+        goto end;
+    }
+
+    const Elf32_Phdr *phdr = (const Elf32_Phdr *)(image + ehdr->e_phoff);
+    for (int i = 0; i < ehdr->e_phnum; i++) {
+        if (phdr[i].p_type != PT_LOAD) {
+            continue;
+        }
+        if (phdr[i].p_offset + (size_t)phdr[i].p_filesz > size ||
+            phdr[i].p_filesz > phdr[i].p_memsz ||
+            phdr[i].p_vaddr + (UDWord_t)phdr[i].p_memsz > MEM_SPACE_SIZE) {
+            fprintf (stderr, "<Loading ELF File : segment %d is broken>\n", i);
+            goto end;
+        }
+        LoadSegment (image, fd, phdr[i].p_vaddr, phdr[i].p_offset, phdr[i].p_filesz, env);
+        // .bss
+        WriteMemoryImage (phdr[i].p_vaddr + phdr[i].p_filesz, NULL,
+                          phdr[i].p_memsz - phdr[i].p_filesz, env);
+        AddLoadRange (phdr[i].p_vaddr, phdr[i].p_filesz, env);
+    }
+
+    LoadElfSymbols (image, size, env);
+    env->pc = ehdr->e_entry;
+    result = true;
+
+end:
+    munmap ((void *)image, size);
+    return result;
+}
@@ -1,544 +1,1281 @@
-/*
- * Copyright (c) 2015, Masayuki Kimura
- * All rights reserved.
- *
- *     Redistribution and use in source and binary forms, with or without
- *     modification, are permitted provided that the following conditions are met:
- *     * Redistributions of source code must retain the above copyright
- *     notice, this list of conditions and the following disclaimer.
- *     * Redistributions in binary form must reproduce the above copyright
- *     notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *     * Neither the name of the Masayuki Kimura nor the
- *       names of its contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
- *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#include <stdio.h>
-#include <stdint.h>
-#include "./basic.h"
-#include "./env.h"
-#include "./trace.h"
-
-static binder Binder (void *, void *, binder, void *);
-
-static Byte_t  LoadMemByte   (Addr_t, riscvEnv);
-static HWord_t LoadMemHWord  (Addr_t, riscvEnv);
-static Word_t  LoadMemWord   (Addr_t, riscvEnv);
-static void    StoreMemByte  (Addr_t, Byte_t , riscvEnv);
-static void    StoreMemHWord (Addr_t, HWord_t, riscvEnv);
-static void    StoreMemWord  (Addr_t, Word_t , riscvEnv);
-
-static uint32_t htoi (uint8_t);
-
-
-void *checked_malloc (size_t size)
-{
-    void *mem;
-    if ((mem = malloc (size)) == NULL) {
-        perror ("malloc");
-        exit (EXIT_FAILURE);
-    }
-    return mem;
-}
-
-
-/*!
- * extract operand from inst from left to right
- */
-uint32_t ExtractBitField (uint32_t hex, uint32_t left, uint32_t right)
-{
-    return (hex >> right) & ((1 << (left - right + 1)) - 1);
-}
-
-
-uint32_t ExtractIField (uint32_t hex)
-{
-    uint32_t uimm32 = ExtractBitField (hex, 31, 20);
-    return ExtendSign (uimm32, 11);
-}
-
-
-uint32_t ExtractSBField (uint32_t hex)
-{
-    uint32_t i07_07 = ExtractBitField (hex,  7,  7) & 0x01UL;
-    uint32_t i11_08 = ExtractBitField (hex, 11,  8) & 0x0fUL;
-    uint32_t i30_25 = ExtractBitField (hex, 30, 25) & 0x03fUL;
-    uint32_t i31_31 = ExtractBitField (hex, 31, 31) & 0x01UL;
-
-    uint32_t u_res = (i31_31 << 12) |
-                     (i07_07 << 11) |
-                     (i30_25 <<  5) |
-                     (i11_08 <<  1);
-    return ExtendSign (u_res, 12);
-}
-
-
-uint32_t ExtractUJField (uint32_t hex)
-{
-    uint32_t i24_21 = ExtractBitField (hex, 24, 21) & 0x0fUL;
-    uint32_t i30_25 = ExtractBitField (hex, 30, 25) & 0x03fUL;
-    uint32_t i20_20 = ExtractBitField (hex, 20, 20) & 0x01UL;
-    uint32_t i19_12 = ExtractBitField (hex, 19, 12) & 0x0ffUL;
-    uint32_t i31_31 = ExtractBitField (hex, 31, 31) & 0x01UL;
-
-    uint32_t u_res = (i31_31 << 20) |
-                     (i19_12 << 12) |
-                     (i20_20 << 11) |
-                     (i30_25 <<  5) |
-                     (i24_21 <<  1);
-    return ExtendSign (u_res, 20);
-}
-
-
-/*!
- * sign extension
- */
-uint32_t ExtendSign (uint32_t data, uint32_t msb)
-{
-    uint32_t mask = 0x0UL;
-    if (((data >> msb) & 0x01) == 0x01) {
-        mask = 0xFFFFFFFFUL & (~((1 << msb) - 1));
-    }
-    return data | mask;
-}
-
-
-//*
-//* === Basic Table Operations ===
-//*
-
-/*!
- * Binder
- * bind key to value
- * \param key     key of value
- * \param value   input value
- * \param next    next element
- */
-static binder Binder (void *key, void *value, binder next, void *prevtop)
-{
-
-    binder b = (binder) checked_malloc (sizeof (*b));
-    b->key = key;
-    b->value = value;
-    b->next=next;
-    b->prevtop = prevtop;
-
-    return b;
-}
-
-
-/*!
- * Table operations
- */
-TAB_table TAB_empty(void)
-{
-    TAB_table t = (TAB_table) checked_malloc (sizeof (*t));
-    uint32_t i;
-    t->top = NULL;
-    for (i = 0; i < TABSIZE; i++) {
-        t->table[i] = NULL;
-    }
-
-    return t;
-}
-
-void TAB_enter (TAB_table t, void *key, void *value)
-{
-    uint32_t index;
-    index = ((unsigned)key) % TABSIZE;
-    t->table[index] = Binder (key, value, t->table[index], t->top) ;
-    t->top = key;
-}
-
-void *TAB_look (TAB_table t, void *key)
-{
-    uint32_t index;
-    binder b;
-
-    index = ((unsigned)key) % TABSIZE;
-    for (b = t->table[index]; b; b = NEXT (b))  {
-        if  (b->key == key) {
-            return b->value;
-        }
-    }
-    return NULL;
-}
-
-//*
-//* === Memory Operations ===
-//*
-
-/*!
- * create instruction table
- */
-MemTable CreateMemTable (void)
-{
-    MemTable table = (MemTable)TAB_empty ();
-    return table;
-}
-
-/*!
- * insert instruction into table
- * \param table   table to be inserted info
- * \param key     key used in search
- * \param info    info structure to be inserted
- */
-void InsertMemTable (MemTable table, Addr_t addr, Byte_t info)
-{
-    TAB_enter ((TAB_table)table, (void *)addr, (void *)info);
-    return;
-}
-
-/*!
- * search info from pc location
- * \param table  target table to be searched
- * \param pc     target pc address
- * \return       info structure to be searched
- */
-Byte_t SearchMemTable (MemTable table, Addr_t addr)
-{
-    return TAB_look (table, (void *)addr);
-}
-
-
-/*!
- * create new RISCV simulation environment
- * \return RiscvEnv structure (not formatted)
- */
-riscvEnv CreateNewRISCVEnv (FILE *fp)
-{
-    riscvEnv env = (riscvEnv) checked_malloc (sizeof (*env));
-    env->trace   = (traceInfo) checked_malloc (sizeof (*(env->trace)));
-    env->memory  = CreateMemTable ();
-    env->dbgfp   = fp;
-
-    return env;
-}
-
-
-/*!
- * Read from General Register
- * \param reg register address to read
- * \param env RISC-V environment
- */
-Word_t GRegRead (RegAddr_t reg, riscvEnv env)
-{
-    Word_t value = env->regs [reg];
-    RecordTraceGRegRead (env->trace, reg, value);
-
-    return value;
-}
-
-
-/*!
- * Write Data General Register
- * \param reg  register address to write
- * \param daat write data
- * \param env  RISC-V environment
- */
-void GRegWrite (RegAddr_t reg, Word_t data, riscvEnv env)
-{
-    RecordTraceGRegWrite (env->trace, reg, data);
-    if (reg != 0x00) {
-        env->regs [reg] = data;
-    }
-}
-
-
-/*!
- * Write new Addr to PC
- * \param reg  register address to write
- * \param daat write data
- * \param env  RISC-V environment
- */
-void PCWrite (Addr_t addr, riscvEnv env)
-{
-    RecordTraceGRegWrite (env->trace, REG_PC, addr);
-    env->pc = addr;
-}
-
-
-/*!
- * Read current PC
- * \param reg  register address to write
- * \param daat write data
- * \param env  RISC-V environment
- */
-Addr_t PCRead (riscvEnv env)
-{
-    return env->pc;
-}
-
-
-/*!
- * Reference from Memory
- * \param addr address
- * \param env RISCV environment
- */
-static Byte_t LoadMemByte (Addr_t addr, riscvEnv env)
-{
-    Byte_t mem = SearchMemTable (env->memory, addr);
-    return mem;
-}
-
-
-/*!
- * Reference from Memory
- * \param addr address
- * \param env RISCV environment
- */
-static HWord_t LoadMemHWord (Addr_t addr, riscvEnv env)
-{
-    Word_t byte1 = LoadMemByte (addr + 1, env);
-    Word_t byte0 = LoadMemByte (addr + 0, env);
-    HWord_t res;
-    if ((addr & 0x01) == 0) {
-        res = (byte1 << 8) + byte0;
-        return res;
-    } else {
-        fprintf (env->dbgfp, "<Error: Address Misalign: HalfWord Addr = %08x>\n", addr);
-        return 0x0;
-    }
-
-}
-
-
-/*!
- * Reference from Memory
- * \param addr address
- * \param env RISCV environment
- */
-static Word_t LoadMemWord (Addr_t addr, riscvEnv env)
-{
-    Word_t byte3 = LoadMemByte (addr + 3, env) & 0x00FFUL;
-    Word_t byte2 = LoadMemByte (addr + 2, env) & 0x00FFUL;
-    Word_t byte1 = LoadMemByte (addr + 1, env) & 0x00FFUL;
-    Word_t byte0 = LoadMemByte (addr + 0, env) & 0x00FFUL;
-    Word_t res = 0;
-    if ((addr & 0x03) == 0) {
-        res = (byte3 << 24) + (byte2 << 16)
-            + (byte1 << 8) + byte0;
-    } else {
-        fprintf (env->dbgfp, "<Error: Address Misalign: Byte Addr = %08x>\n", addr);
-    }
-
-    return res;
-}
-
-
-/*!
- * Store Data to Memory (Byte)
- * \param addr address
- * \param env RISCV environment
- */
-static void StoreMemByte (Addr_t addr, Byte_t data, riscvEnv env)
-{
-    InsertMemTable (env->memory, addr, data);
-    return;
-}
-
-
-/*!
- * Store Data to Memory (HWord)
- * \param addr address
- * \param env RISCV environment
- */
-static void StoreMemHWord (Addr_t addr, HWord_t data, riscvEnv env)
-{
-    if ((addr & 0x01) == 0) {
-        StoreMemByte (addr + 0, (data >>  0) & 0x00ff, env);
-        StoreMemByte (addr + 1, (data >>  8) & 0x00ff, env);
-    } else {
-        fprintf (env->dbgfp, "<Address Misalign Error: Half Word Addr = %08x>\n", addr);
-    }
-
-    return;
-}
-
-
-/*!
- * Store Data to Memory (Word)
- * \param addr address
- * \param env RISCV environment
- */
-static void StoreMemWord (Addr_t addr, Word_t data, riscvEnv env)
-{
-    if ((addr & 0x03) == 0) {
-        StoreMemByte (addr + 0, (data >>  0) & 0x00ff, env);
-        StoreMemByte (addr + 1, (data >>  8) & 0x00ff, env);
-        StoreMemByte (addr + 2, (data >> 16) & 0x00ff, env);
-        StoreMemByte (addr + 3, (data >> 24) & 0x00ff, env);
-    } else {
-        fprintf (env->dbgfp, "<Address Misalign Error: Word Addr = %08x>\n", addr);
-    }
-
-    return;
-}
-
-
-/*!
- * Load Data from Memory
- */
-Word_t LoadMemory (Addr_t addr, Size_t size, riscvEnv env)
-{
-    Word_t res;
-    switch (size) {
-    case Size_Byte:
-        res = LoadMemByte  (addr, env);
-        RecordTraceMemRead (env->trace, addr, res, size);
-        break;
-    case Size_HWord:
-        res = (Word_t)LoadMemHWord (addr, env);
-        RecordTraceMemRead (env->trace, addr, res, size);
-        break;
-    case Size_Word:
-        res = (Word_t)LoadMemWord (addr, env);
-        RecordTraceMemRead (env->trace, addr, res, size);
-        break;
-    default:
-        return 0;
-        fprintf (env->dbgfp, "<Internal Error: Illegal size of LoadMemory : %d>\n", size);
-        break;
-    }
-    return res;
-}
-
-
-/*!
- * Load Data from Memory
- * it is different from LoadMemory, FetchMemory doesn't recorded to trace
- */
-Word_t FetchMemory (Addr_t addr, riscvEnv env)
-{
-    Word_t res = LoadMemWord (addr, env);
-    return res;
-}
-
-
-void StoreMemory (Addr_t addr, Word_t data, Size_t size, riscvEnv env)
-{
-    switch (size) {
-    case Size_Byte:
-        StoreMemByte (addr, data, env);
-        RecordTraceMemWrite (env->trace, addr, data, size);
-        break;
-    case Size_HWord:
-        StoreMemHWord (addr, data, env);
-        RecordTraceMemWrite (env->trace, addr, data, size);
-        break;
-    case Size_Word:
-        StoreMemWord (addr, data, env);
-        RecordTraceMemWrite (env->trace, addr, data, size);
-        break;
-    default:
-        fprintf (env->dbgfp, "<Internal Error: Illegal size of StoreMem is %d>\n", size);
-        exit (EXIT_FAILURE);
-        break;
-    }
-    return;
-}
-
-
-void AdvanceStep (riscvEnv env)
-{
-    env->step++;
-    if (env->trace->isbranch == false) {
-        PCWrite (PCRead (env) + 4, env);
-    }
-}
-
-
-/*!
- * load s-rec motrola format
- * \param fp   file pointer to be loaded srec
- * \param env  environment to be load
- * \return     max memory address to be loaded
- */
-uint32_t LoadSrec (FILE *fp, riscvEnv env)
-{
-    char buff[256 + 1];
-    uint32_t i;
-    char load_data = false;
-    uint32_t pc_max = 0x00000000;
-
-    while (fgets (buff, 256, fp) != NULL) {
-        if (buff[0] == 'S') { // valid s-record
-            uint8_t type = buff[1] - 0x30;
-            uint8_t byte_length = (htoi (buff[2]) << 4) + htoi (buff[3]);
-            uint32_t address = 0;
-            uint8_t addr_len;   // length of address format
-            switch (type) {
-            case 0 : // Block header
-                addr_len = 4; load_data = false; break;  // 2 byte
-            case 1 : // Data sequence
-                addr_len = 4; load_data = true;  break;  // 2 byte
-            case 2 : // Data sequence
-                addr_len = 6; load_data = true;  break;  // 3 byte
-            case 3 : // Data sequence
-                addr_len = 8; load_data = true;  break;  // 4 byte
-            case 5 : // Record count
-                addr_len = 4; load_data = false; break;  // 2 byte
-            case 7 : // End of block
-                addr_len = 8; load_data = false; break;  // 4 byte
-            case 8 : // End of block
-                addr_len = 6; load_data = false; break;  // 3 byte
-            case 9 : // End of block
-                addr_len = 4; load_data = false; break;  // 2 byte
-            default : // illegal type
-                addr_len = 0;
-                load_data = false;
-                fprintf (stderr, "<Loading Srecord File : type is illegal %d>\n", type);
-                break;
-            }
-
-            if (load_data == true) {
-                //** read address of S-Rec
-                int index; // head of address
-                const int addr_head = 4;
-                for (index = 0; index < addr_len; index++) {
-                    address = (address << 4) + htoi (buff[index + addr_head]);
-                }
-
-                //** read word
-                int data_head = index + addr_head;   // head of data is tail of address information
-                for (i = 0; i < byte_length - addr_len / 2 - 1; i++) {
-                    uint8_t data = (htoi (buff[i * 2 + data_head]) << 4) + htoi (buff[i * 2 + 1 + data_head]);
-                    StoreMemory (address, data, Size_Byte, env);
-                    address++;
-                }
-                if (pc_max < address) {
-                    pc_max = address;
-                }
-            }
-        }
-    }
-
-    return pc_max;
-}
-
-
-static uint32_t htoi (uint8_t h)
-{
-
-    if (h >= '0' && h <= '9') {
-        return h - '0';  // number
-    } else if (h >= 'A' && h <= 'F') {
-        return h - 'A' + 10; // 0xA - 0xF
-    } else if (h >= 'a' && h <= 'f') {
-        return h - 'a' + 10;
-    } else {
-        return -1;
-    }
-}
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "./basic.h"
+#include "./env.h"
+#include "./trace.h"
+#include "./block.h"
+#include "./jit.h"
+
+/*
+ * guest memory is little-endian and accessed with host loads/stores.
+ */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "Swimmer-RISCV requires little-endian host"
+#endif
+
+static inline Byte_t *LookupTLB (Addr_t, Size_t, riscvEnv);
+static Byte_t *FillTLB (Addr_t, bool, riscvEnv);
+
+static Byte_t  LoadMemByte   (Addr_t, riscvEnv);
+static HWord_t LoadMemHWord  (Addr_t, riscvEnv);
+static Word_t  LoadMemWord   (Addr_t, riscvEnv);
+static void    StoreMemByte  (Addr_t, Byte_t , riscvEnv);
+static void    StoreMemHWord (Addr_t, HWord_t, riscvEnv);
+static void    StoreMemWord  (Addr_t, Word_t , riscvEnv);
+
+
+void *checked_malloc (size_t size)
+{
+    void *mem;
+    if ((mem = malloc (size)) == NULL) {
+        perror ("malloc");
+        exit (EXIT_FAILURE);
+    }
+    return mem;
+}
+
+
+/*!
+ * extract operand from inst from left to right
+ */
+uint32_t ExtractBitField (uint32_t hex, uint32_t left, uint32_t right)
+{
+    return (hex >> right) & ((1 << (left - right + 1)) - 1);
+}
+
+
+//*
+//* === Memory Operations ===
+//*
+
+/*!
+ * create guest memory table
+ * \param type  backend of guest memory
+ */
+MemTable CreateMemTable (memType type)
+{
+    MemTable table = (MemTable) checked_malloc (sizeof (*table));
+    table->type = type;
+    table->base = NULL;
+    memset (table->dir, 0, sizeof (table->dir));
+    table->dirty = (uint64_t *) calloc (MEM_DIRTY_WORDS, sizeof (uint64_t));
+    if (table->dirty == NULL) {
+        perror ("calloc");
+        exit (EXIT_FAILURE);
+    }
+
+    if (type == memTypeMmap) {
+        void *base = mmap (NULL, MEM_SPACE_SIZE, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (base == MAP_FAILED) {
+            perror ("mmap");
+            exit (EXIT_FAILURE);
+        }
+        table->base = (Byte_t *)base;
+    }
+    return table;
+}
+
+/*!
+ * allocate zero-filled page of paged memory, referred from one table
+ */
+static Byte_t *AllocMemPage (void)
+{
+    Byte_t *page = (Byte_t *) checked_malloc (MEM_PAGE_SIZE + sizeof (atomic_uint));
+    memset (page, 0, MEM_PAGE_SIZE);
+    atomic_init (MEM_PAGE_REFS (page), 1);
+    return page;
+}
+
+/*!
+ * drop one reference of page, and free it by the last one
+ */
+static void ReleaseMemPage (Byte_t *page)
+{
+    if (atomic_fetch_sub (MEM_PAGE_REFS (page), 1) == 1) {
+        free (page);
+    }
+}
+
+
+/*!
+ * clone paged memory table, pages are shared copy-on-write.
+ * dirty pages of new table are cleared.
+ * \param table  memory table to be cloned, must be memTypePaged
+ * \return       new table
+ */
+MemTable CloneMemTable (MemTable table)
+{
+    MemTable clone = CreateMemTable (memTypePaged);
+    for (uint32_t d = 0; d < MEM_DIR_SIZE; d++) {
+        if (table->dir[d] == NULL) {
+            continue;
+        }
+        clone->dir[d] = (Byte_t **) checked_malloc (sizeof (Byte_t *) * MEM_TABLE_SIZE);
+        memcpy (clone->dir[d], table->dir[d], sizeof (Byte_t *) * MEM_TABLE_SIZE);
+        for (uint32_t t = 0; t < MEM_TABLE_SIZE; t++) {
+            if (table->dir[d][t] != NULL) {
+                atomic_fetch_add (MEM_PAGE_REFS (table->dir[d][t]), 1);
+            }
+        }
+    }
+    return clone;
+}
+
+
+/*!
+ * release memory table and its pages
+ * \param table  memory table to be destroyed
+ */
+void DestroyMemTable (MemTable table)
+{
+    if (table->type == memTypeMmap) {
+        munmap (table->base, MEM_SPACE_SIZE);
+    } else {
+        for (uint32_t d = 0; d < MEM_DIR_SIZE; d++) {
+            if (table->dir[d] == NULL) {
+                continue;
+            }
+            for (uint32_t t = 0; t < MEM_TABLE_SIZE; t++) {
+                if (table->dir[d][t] != NULL) {
+                    ReleaseMemPage (table->dir[d][t]);
+                }
+            }
+            free (table->dir[d]);
+        }
+    }
+    free (table->dirty);
+    free (table);
+}
+
+
+/*!
+ * check that page can be written without copy
+ * \param table  memory table which has page
+ * \param page   host page
+ */
+static inline bool IsMemPageWritable (MemTable table, Byte_t *page)
+{
+    return table->type == memTypeMmap || atomic_load (MEM_PAGE_REFS (page)) == 1;
+}
+
+
+/*!
+ * get host page which holds guest address
+ * \param table   target memory table
+ * \param addr    guest address
+ * \param alloc   if true, page is going to be written. zero-filled page is
+ *                allocated when not touched yet, shared page is copied, and
+ *                page is marked dirty.
+ * \return        head of host page, NULL if not allocated
+ */
+Byte_t *GetMemPage (MemTable table, Addr_t addr, bool alloc)
+{
+    if (alloc == true) {
+        uint64_t *dirty = &table->dirty[addr >> (MEM_PAGE_BITS + 6)];
+        uint64_t  bit   = 1ULL << ((addr >> MEM_PAGE_BITS) % 64);
+        if ((__atomic_load_n (dirty, __ATOMIC_RELAXED) & bit) == 0) {
+            __atomic_fetch_or (dirty, bit, __ATOMIC_RELAXED);
+        }
+    }
+    if (table->type == memTypeMmap) {
+        return table->base + (addr & ~MEM_PAGE_MASK);
+    }
+
+    uint32_t dir_idx   = addr >> (MEM_TABLE_BITS + MEM_PAGE_BITS);
+    uint32_t table_idx = (addr >> MEM_PAGE_BITS) & (MEM_TABLE_SIZE - 1);
+
+    // harts share table, so new table and page are installed by CAS
+    Byte_t **page_table = __atomic_load_n (&table->dir[dir_idx], __ATOMIC_ACQUIRE);
+    if (page_table == NULL) {
+        if (alloc == false) {
+            return NULL;
+        }
+        Byte_t **new_table = (Byte_t **) checked_malloc (sizeof (Byte_t *) * MEM_TABLE_SIZE);
+        memset (new_table, 0, sizeof (Byte_t *) * MEM_TABLE_SIZE);
+        if (__atomic_compare_exchange_n (&table->dir[dir_idx], &page_table, new_table, false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            page_table = new_table;
+        } else {
+            free (new_table);   // page_table is the one installed by other hart
+        }
+    }
+
+    Byte_t *page = __atomic_load_n (&page_table[table_idx], __ATOMIC_ACQUIRE);
+    if (alloc == true) {
+        if (page == NULL) {
+            Byte_t *new_page = AllocMemPage ();
+            if (__atomic_compare_exchange_n (&page_table[table_idx], &page, new_page, false,
+                                             __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                page = new_page;
+            } else {
+                ReleaseMemPage (new_page);
+            }
+        } else if (IsMemPageWritable (table, page) == false) {
+            Byte_t *copy = AllocMemPage ();
+            memcpy (copy, page, MEM_PAGE_SIZE);
+            if (__atomic_compare_exchange_n (&page_table[table_idx], &page, copy, false,
+                                             __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                ReleaseMemPage (page);
+                page = copy;
+            } else {
+                ReleaseMemPage (copy);
+            }
+        }
+    }
+    return page;
+}
+
+/*!
+ * create new RISCV simulation environment
+ * \return RiscvEnv structure (not formatted)
+ */
+riscvEnv CreateNewRISCVEnv (FILE *fp, memType mem_type)
+{
+    riscvEnv env = (riscvEnv) checked_malloc (sizeof (*env));
+    memset (env, 0, sizeof (*env));
+    env->trace   = (traceInfo) checked_malloc (sizeof (*(env->trace)));
+    env->memory  = CreateMemTable (mem_type);
+    env->dec_cache = CreateDecCache ();
+    env->dbgfp   = fp;
+    env->inst_len = 4;
+    FlushTLB (env);
+
+    return env;
+}
+
+
+/*!
+ * clone RISCV simulation environment
+ * child starts from architecture state of parent, and shares guest pages
+ * copy-on-write with paged memory. caches of child are empty, and it has
+ * no trace output nor stop conditions. symbols are borrowed from parent,
+ * so parent has to outlive child.
+ * \param parent  environment to be cloned
+ * \return        child environment
+ */
+riscvEnv CloneRISCVEnv (riscvEnv parent)
+{
+    riscvEnv env = CreateNewRISCVEnv (parent->dbgfp, parent->memory->type);
+    if (parent->memory->type == memTypeMmap) {
+        // no page to be shared, touched pages are copied
+        uint32_t page_count;
+        Addr_t  *pages = ListTouchedPages (parent, &page_count);
+        for (uint32_t i = 0; i < page_count; i++) {
+            WriteMemoryImage (pages[i], GetMemPage (parent->memory, pages[i], false), MEM_PAGE_SIZE, env);
+        }
+        free (pages);
+    } else {
+        DestroyMemTable (env->memory);
+        env->memory = CloneMemTable (parent->memory);
+    }
+
+    memcpy (env->regs, parent->regs, sizeof (env->regs));
+    env->pc        = parent->pc;
+    env->step      = parent->step;
+    env->exit_code = parent->exit_code;
+    env->max_cycle = parent->max_cycle;
+    env->exec_mode = parent->exec_mode == execModeBlock ? execModeBlock : execModeNoTrace;
+    if (parent->jit_cache != NULL) {
+        env->jit_cache = CreateJITCache ();
+    }
+
+    if (parent->load_range_count > 0) {
+        env->load_ranges = (loadRange *) checked_malloc (sizeof (loadRange) * parent->load_range_count);
+        memcpy (env->load_ranges, parent->load_ranges, sizeof (loadRange) * parent->load_range_count);
+        env->load_range_count = parent->load_range_count;
+    }
+    env->symbols      = parent->symbols;
+    env->symbol_count = parent->symbol_count;
+
+    // pages of parent are shared now, so writes must go through memory table
+    FlushTLB (parent);
+    return env;
+}
+
+
+/*!
+ * release environment created by CreateNewRISCVEnv or CloneRISCVEnv
+ * files are left to owner, symbols are released by environment which loaded them.
+ * \param env  environment to be destroyed
+ */
+void DestroyRISCVEnv (riscvEnv env)
+{
+    if (env->memory != NULL) {   // NULL if memory is owned by other hart
+        DestroyMemTable (env->memory);
+    }
+    if (env->ckpt_base != NULL) {
+        DestroyMemTable (env->ckpt_base);
+    }
+    DestroyBlockCache (env->block_cache);
+    DestroyJITCache (env->jit_cache);
+    free (env->dec_cache);
+    free (env->trace);
+    free (env->load_ranges);
+    if (env->symbol_names != NULL) {   // NULL if symbols are borrowed from parent
+        free (env->symbols);
+        free (env->symbol_names);
+    }
+    free (env);
+}
+
+
+/*!
+ * Read from General Register
+ * \param reg register address to read
+ * \param env RISC-V environment
+ */
+Word_t GRegRead (RegAddr_t reg, riscvEnv env)
+{
+    Word_t value = env->regs [reg];
+    RecordTraceGRegRead (env->trace, reg, value);
+
+    return value;
+}
+
+
+/*!
+ * Write Data General Register
+ * \param reg  register address to write
+ * \param daat write data
+ * \param env  RISC-V environment
+ */
+void GRegWrite (RegAddr_t reg, Word_t data, riscvEnv env)
+{
+    RecordTraceGRegWrite (env->trace, reg, data);
+    if (reg != 0x00) {
+        env->regs [reg] = data;
+    }
+}
+
+
+/*!
+ * Write new Addr to PC
+ * \param reg  register address to write
+ * \param daat write data
+ * \param env  RISC-V environment
+ */
+void PCWrite (Addr_t addr, riscvEnv env)
+{
+    RecordTraceGRegWrite (env->trace, REG_PC, addr);
+    env->pc = addr;
+}
+
+
+/*!
+ * Read current PC
+ * \param reg  register address to write
+ * \param daat write data
+ * \param env  RISC-V environment
+ */
+Addr_t PCRead (riscvEnv env)
+{
+    return env->pc;
+}
+
+
+/*!
+ * Invalidate all entries of software TLB
+ * \param env RISCV environment
+ */
+void FlushTLB (riscvEnv env)
+{
+    int i;
+    for (i = 0; i < TLB_SIZE; i++) {
+        env->tlb[i].tag  = TLB_INVALID;
+        env->tlb[i].wtag = TLB_INVALID;
+        env->tlb[i].page = NULL;
+    }
+}
+
+
+/*!
+ * Lookup software TLB
+ * misaligned address keeps low bits in tag, so it always misses.
+ * \param addr address
+ * \param size access size
+ * \param env RISCV environment
+ * \return host address, or NULL if TLB miss
+ */
+static inline Byte_t *LookupTLB (Addr_t addr, Size_t size, riscvEnv env)
+{
+    tlbEntry *entry = &env->tlb[(addr >> MEM_PAGE_BITS) & (TLB_SIZE - 1)];
+    Addr_t    tag   = addr & (~MEM_PAGE_MASK | ((1 << size) - 1));
+
+    if (entry->tag == tag) {
+        env->tlb_hit++;
+        return entry->page + (addr & MEM_PAGE_MASK);
+    }
+    env->tlb_miss++;
+    return NULL;
+}
+
+
+/*!
+ * Lookup software TLB for store
+ * shared copy-on-write page and clean page miss, so memory table can copy
+ * the page and mark it dirty. stores to dirty page hit without any check.
+ * \param addr address
+ * \param size access size
+ * \param env RISCV environment
+ * \return host address, or NULL if TLB miss
+ */
+static inline Byte_t *LookupTLBWrite (Addr_t addr, Size_t size, riscvEnv env)
+{
+    tlbEntry *entry = &env->tlb[(addr >> MEM_PAGE_BITS) & (TLB_SIZE - 1)];
+    Addr_t    tag   = addr & (~MEM_PAGE_MASK | ((1 << size) - 1));
+
+    if (entry->wtag == tag) {
+        env->tlb_hit++;
+        return entry->page + (addr & MEM_PAGE_MASK);
+    }
+    env->tlb_miss++;
+    return NULL;
+}
+
+
+/*!
+ * Refill software TLB from memory table
+ * \param addr  address
+ * \param alloc allocate page if not touched yet
+ * \param env   RISCV environment
+ * \return host page, NULL if page is not touched yet
+ */
+static Byte_t *FillTLB (Addr_t addr, bool alloc, riscvEnv env)
+{
+    Byte_t *page = GetMemPage (env->memory, addr, alloc);
+    if (page != NULL) {
+        tlbEntry *entry = &env->tlb[(addr >> MEM_PAGE_BITS) & (TLB_SIZE - 1)];
+        entry->tag  = addr & ~MEM_PAGE_MASK;
+        entry->wtag = (alloc == true || (IsDirtyPage (env->memory, addr) &&
+                                         IsMemPageWritable (env->memory, page))) ? entry->tag : TLB_INVALID;
+        entry->page = page;
+    }
+    return page;
+}
+
+
+/*!
+ * Reference from Memory
+ * \param addr address
+ * \param env RISCV environment
+ */
+static Byte_t LoadMemByte (Addr_t addr, riscvEnv env)
+{
+    Byte_t *page = FillTLB (addr, false, env);
+    if (page == NULL) {
+        return 0;
+    }
+    return page[addr & MEM_PAGE_MASK];
+}
+
+
+/*!
+ * Reference from Memory
+ * aligned access never crosses a page, so it is done in one host access.
+ * \param addr address
+ * \param env RISCV environment
+ */
+static HWord_t LoadMemHWord (Addr_t addr, riscvEnv env)
+{
+    HWord_t res = 0;
+    if ((addr & 0x01) == 0) {
+        Byte_t *page = FillTLB (addr, false, env);
+        if (page != NULL) {
+            memcpy (&res, &page[addr & MEM_PAGE_MASK], sizeof (res));
+        }
+        return res;
+    } else {
+        fprintf (env->dbgfp, "<Error: Address Misalign: HalfWord Addr = %08x>\n", addr);
+        return 0x0;
+    }
+
+}
+
+
+/*!
+ * Reference from Memory
+ * \param addr address
+ * \param env RISCV environment
+ */
+static Word_t LoadMemWord (Addr_t addr, riscvEnv env)
+{
+    Word_t res = 0;
+    if ((addr & 0x03) == 0) {
+        Byte_t *page = FillTLB (addr, false, env);
+        if (page != NULL) {
+            memcpy (&res, &page[addr & MEM_PAGE_MASK], sizeof (res));
+        }
+    } else {
+        fprintf (env->dbgfp, "<Error: Address Misalign: Byte Addr = %08x>\n", addr);
+    }
+
+    return res;
+}
+
+
+/*!
+ * Store Data to Memory (Byte)
+ * \param addr address
+ * \param env RISCV environment
+ */
+static void StoreMemByte (Addr_t addr, Byte_t data, riscvEnv env)
+{
+    Byte_t *page = FillTLB (addr, true, env);
+    page[addr & MEM_PAGE_MASK] = data;
+    return;
+}
+
+
+/*!
+ * Store Data to Memory (HWord)
+ * \param addr address
+ * \param env RISCV environment
+ */
+static void StoreMemHWord (Addr_t addr, HWord_t data, riscvEnv env)
+{
+    if ((addr & 0x01) == 0) {
+        Byte_t *page = FillTLB (addr, true, env);
+        memcpy (&page[addr & MEM_PAGE_MASK], &data, sizeof (data));
+    } else {
+        fprintf (env->dbgfp, "<Address Misalign Error: Half Word Addr = %08x>\n", addr);
+    }
+
+    return;
+}
+
+
+/*!
+ * Store Data to Memory (Word)
+ * \param addr address
+ * \param env RISCV environment
+ */
+static void StoreMemWord (Addr_t addr, Word_t data, riscvEnv env)
+{
+    if ((addr & 0x03) == 0) {
+        Byte_t *page = FillTLB (addr, true, env);
+        memcpy (&page[addr & MEM_PAGE_MASK], &data, sizeof (data));
+    } else {
+        fprintf (env->dbgfp, "<Address Misalign Error: Word Addr = %08x>\n", addr);
+    }
+
+    return;
+}
+
+
+/*!
+ * Load Data from Memory without trace recording
+ * TLB hit is served directly from host page, otherwise go to memory table.
+ */
+Word_t LoadMemoryNoTrace (Addr_t addr, Size_t size, riscvEnv env)
+{
+    Byte_t *host = LookupTLB (addr, size, env);
+
+    if (host != NULL) {
+        switch (size) {
+        case Size_Byte:
+            return *host;
+        case Size_HWord: {
+            HWord_t hres;
+            memcpy (&hres, host, sizeof (hres));
+            return hres;
+        }
+        case Size_Word: {
+            Word_t res;
+            memcpy (&res, host, sizeof (res));
+            return res;
+        }
+        }
+    }
+
+    switch (size) {
+    case Size_Byte:
+        return LoadMemByte  (addr, env);
+    case Size_HWord:
+        return (Word_t)LoadMemHWord (addr, env);
+    case Size_Word:
+        return (Word_t)LoadMemWord (addr, env);
+    default:
+        fprintf (env->dbgfp, "<Internal Error: Illegal size of LoadMemory : %d>\n", size);
+        return 0;
+    }
+}
+
+
+/*!
+ * Load Data from Memory
+ */
+Word_t LoadMemory (Addr_t addr, Size_t size, riscvEnv env)
+{
+    Word_t res = LoadMemoryNoTrace (addr, size, env);
+    RecordTraceMemRead (env->trace, addr, res, size);
+    return res;
+}
+
+
+/*!
+ * Load Data from Memory
+ * it is different from LoadMemory, FetchMemory doesn't recorded to trace
+ * instruction on halfword boundary is fetched by halfwords, and upper
+ * half is not fetched if lower one is compressed instruction.
+ */
+Word_t FetchMemory (Addr_t addr, riscvEnv env)
+{
+    Word_t  res;
+
+    if ((addr & 0x03) != 0) {
+        res = LoadMemoryNoTrace (addr, Size_HWord, env);
+        if ((res & 0x03) == 0x03) {
+            res |= LoadMemoryNoTrace (addr + 2, Size_HWord, env) << 16;
+        }
+        return res;
+    }
+
+    Byte_t *host = LookupTLB (addr, Size_Word, env);
+    if (host != NULL) {
+        memcpy (&res, host, sizeof (res));
+    } else {
+        res = LoadMemWord (addr, env);
+    }
+    return res;
+}
+
+
+/*!
+ * Store Data to Memory without trace recording
+ */
+void StoreMemoryNoTrace (Addr_t addr, Word_t data, Size_t size, riscvEnv env)
+{
+    Byte_t *host = LookupTLBWrite (addr, size, env);
+
+    InvalidateDecCache (addr, env);
+    InvalidateBlockCache (addr, env);
+
+    if (env->stop != NULL && env->stop->tohost_enable &&
+        addr == env->stop->tohost_addr) {
+        /* riscv-tests convention: (exit code << 1) | 1 */
+        env->stop_reason = stopToHost;
+        env->exit_code   = (UWord_t)data >> 1;
+    }
+
+    if (host != NULL) {
+        switch (size) {
+        case Size_Byte:
+            *host = data;
+            return;
+        case Size_HWord: {
+            HWord_t hdata = data;
+            memcpy (host, &hdata, sizeof (hdata));
+            return;
+        }
+        case Size_Word:
+            memcpy (host, &data, sizeof (data));
+            return;
+        }
+    }
+
+    switch (size) {
+    case Size_Byte:
+        StoreMemByte (addr, data, env);
+        break;
+    case Size_HWord:
+        StoreMemHWord (addr, data, env);
+        break;
+    case Size_Word:
+        StoreMemWord (addr, data, env);
+        break;
+    default:
+        fprintf (env->dbgfp, "<Internal Error: Illegal size of StoreMem is %d>\n", size);
+        exit (EXIT_FAILURE);
+        break;
+    }
+    return;
+}
+
+
+/*!
+ * Store Data to Memory
+ */
+void StoreMemory (Addr_t addr, Word_t data, Size_t size, riscvEnv env)
+{
+    StoreMemoryNoTrace (addr, data, size, env);
+    RecordTraceMemWrite (env->trace, addr, data, size);
+}
+
+
+/*!
+ * Host address of guest word for atomic memory operation
+ * page is prepared for store, since harts may modify it concurrently.
+ * \param addr address
+ * \param env RISCV environment
+ * \return host address, or NULL if address is misaligned
+ */
+static Word_t *GetAtomicWord (Addr_t addr, riscvEnv env)
+{
+    if ((addr & 0x03) != 0) {
+        fprintf (env->dbgfp, "<Address Misalign Error: Atomic Word Addr = %08x>\n", addr);
+        return NULL;
+    }
+    InvalidateDecCache (addr, env);
+    InvalidateBlockCache (addr, env);
+
+    Byte_t *host = LookupTLBWrite (addr, Size_Word, env);
+    if (host == NULL) {
+        host = FillTLB (addr, true, env) + (addr & MEM_PAGE_MASK);
+    }
+    return (Word_t *)host;
+}
+
+
+/*!
+ * value written by atomic memory operation
+ * \param op    operation
+ * \param old   value in memory
+ * \param data  value of rs2
+ */
+static Word_t AtomicResult (amoOp op, Word_t old, Word_t data)
+{
+    switch (op) {
+    case amoSwap: return data;
+    case amoAdd:  return (UWord_t)old + (UWord_t)data;
+    case amoXor:  return old ^ data;
+    case amoAnd:  return old & data;
+    case amoOr:   return old | data;
+    case amoMin:  return old < data ? old : data;
+    case amoMax:  return old > data ? old : data;
+    case amoMinU: return (UWord_t)old < (UWord_t)data ? old : data;
+    case amoMaxU: return (UWord_t)old > (UWord_t)data ? old : data;
+    }
+    return old;
+}
+
+
+/*!
+ * Atomic read-modify-write of memory word without trace recording
+ * memory may be shared by harts on host threads, so operation is done
+ * by host atomic instruction.
+ * \param addr address
+ * \param op   operation
+ * \param data value of rs2
+ * \param env  RISCV environment
+ * \return value in memory before the operation
+ */
+Word_t AtomicMemoryNoTrace (Addr_t addr, amoOp op, Word_t data, riscvEnv env)
+{
+    Word_t *host = GetAtomicWord (addr, env);
+    if (host == NULL) {
+        return 0;
+    }
+
+    switch (op) {
+    case amoSwap: return __atomic_exchange_n (host, data, __ATOMIC_SEQ_CST);
+    case amoAdd:  return __atomic_fetch_add (host, data, __ATOMIC_SEQ_CST);
+    case amoXor:  return __atomic_fetch_xor (host, data, __ATOMIC_SEQ_CST);
+    case amoAnd:  return __atomic_fetch_and (host, data, __ATOMIC_SEQ_CST);
+    case amoOr:   return __atomic_fetch_or  (host, data, __ATOMIC_SEQ_CST);
+    default:      break;
+    }
+
+    // min / max have no host instruction
+    Word_t old = __atomic_load_n (host, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n (host, &old, AtomicResult (op, old, data), false,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+    }
+    return old;
+}
+
+
+/*!
+ * Atomic read-modify-write of memory word
+ */
+Word_t AtomicMemory (Addr_t addr, amoOp op, Word_t data, riscvEnv env)
+{
+    Word_t old = AtomicMemoryNoTrace (addr, op, data, env);
+    RecordTraceMemRead  (env->trace, addr, old, Size_Word);
+    RecordTraceMemWrite (env->trace, addr, AtomicResult (op, old, data), Size_Word);
+    return old;
+}
+
+
+/*!
+ * Load word and register reservation without trace recording
+ * reservation keeps loaded value, and store conditional succeeds while
+ * memory still has the value.
+ * \param addr address
+ * \param env  RISCV environment
+ */
+Word_t LoadReservedNoTrace (Addr_t addr, riscvEnv env)
+{
+    Word_t *host = GetAtomicWord (addr, env);
+    if (host == NULL) {
+        return 0;
+    }
+    env->reserve_valid = true;
+    env->reserve_addr  = addr;
+    env->reserve_value = __atomic_load_n (host, __ATOMIC_SEQ_CST);
+    return env->reserve_value;
+}
+
+
+/*!
+ * Load word and register reservation
+ */
+Word_t LoadReserved (Addr_t addr, riscvEnv env)
+{
+    Word_t res = LoadReservedNoTrace (addr, env);
+    RecordTraceMemRead (env->trace, addr, res, Size_Word);
+    return res;
+}
+
+
+/*!
+ * Store word if reservation is held, without trace recording
+ * reservation is released whether store succeeds or not.
+ * \param addr address
+ * \param data value to be stored
+ * \param env  RISCV environment
+ * \return true if stored
+ */
+bool StoreConditionalNoTrace (Addr_t addr, Word_t data, riscvEnv env)
+{
+    bool valid = env->reserve_valid && env->reserve_addr == addr;
+    env->reserve_valid = false;
+    if (valid == false) {
+        return false;
+    }
+    Word_t *host = GetAtomicWord (addr, env);
+    if (host == NULL) {
+        return false;
+    }
+    Word_t  expected = env->reserve_value;
+    return __atomic_compare_exchange_n (host, &expected, data, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+
+/*!
+ * Store word if reservation is held
+ */
+bool StoreConditional (Addr_t addr, Word_t data, riscvEnv env)
+{
+    bool stored = StoreConditionalNoTrace (addr, data, env);
+    if (stored == true) {
+        RecordTraceMemWrite (env->trace, addr, data, Size_Word);
+    }
+    return stored;
+}
+
+
+/*!
+ * check breakpoints of current stop conditions
+ * \param pc   address to be checked
+ * \param env  RISC-V environment
+ */
+bool IsBreakpoint (Addr_t pc, riscvEnv env)
+{
+    if (env->stop == NULL) {
+        return false;
+    }
+    uint32_t i;
+    for (i = 0; i < env->stop->breakpoint_count; i++) {
+        if (env->stop->breakpoints[i] == pc) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void AdvanceStep (riscvEnv env)
+{
+    env->step++;
+    if (env->trace->isbranch == false) {
+        PCWrite (PCRead (env) + env->inst_len, env);
+    }
+}
+
+
+/*!
+ * value of hex digit, -1 if character is not hex digit
+ */
+static const int8_t hex_value[256] = {
+    [0 ... 255] = -1,
+    ['0'] = 0,  ['1'] = 1,  ['2'] = 2,  ['3'] = 3,  ['4'] = 4,
+    ['5'] = 5,  ['6'] = 6,  ['7'] = 7,  ['8'] = 8,  ['9'] = 9,
+    ['A'] = 10, ['B'] = 11, ['C'] = 12, ['D'] = 13, ['E'] = 14, ['F'] = 15,
+    ['a'] = 10, ['b'] = 11, ['c'] = 12, ['d'] = 13, ['e'] = 14, ['f'] = 15,
+};
+
+/*!
+ * length of address field in bytes for each record type, 0 if illegal
+ */
+static const uint8_t srec_addr_len[10] = {2, 2, 3, 4, 0, 2, 3, 4, 3, 2};
+
+
+/*!
+ * decode hex string into bytes
+ * \param dst    decoded bytes
+ * \param src    hex string, 2 characters per byte
+ * \param bytes  number of bytes
+ * \return       false if string has non hex character
+ */
+static bool DecodeHex (Byte_t *dst, const char *src, uint32_t bytes)
+{
+    int32_t invalid = 0;
+    for (uint32_t i = 0; i < bytes; i++) {
+        int32_t hi = hex_value[(uint8_t)src[i * 2]];
+        int32_t lo = hex_value[(uint8_t)src[i * 2 + 1]];
+        dst[i] = (hi << 4) | lo;
+        invalid |= hi | lo;   // negative if any digit is illegal
+    }
+    return invalid >= 0;
+}
+
+
+/*!
+ * map whole file for reading, or read it if file cannot be mapped (pipe etc.)
+ * \param fp      file pointer
+ * \param size    size of file
+ * \param mapped  true if returned buffer is mapped, false if allocated
+ * \return        head of file contents, NULL if file is empty
+ */
+static char *MapInputFile (FILE *fp, size_t *size, bool *mapped)
+{
+    struct stat st;
+    if (fstat (fileno (fp), &st) == 0 && S_ISREG (st.st_mode) && st.st_size > 0) {
+        void *image = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno (fp), 0);
+        if (image != MAP_FAILED) {
+            madvise (image, st.st_size, MADV_SEQUENTIAL);
+            *size   = st.st_size;
+            *mapped = true;
+            return (char *)image;
+        }
+    }
+
+    size_t capacity = 1 << 16, length = 0, n;
+    char *buff = (char *) checked_malloc (capacity);
+    while ((n = fread (buff + length, 1, capacity - length, fp)) > 0) {
+        length += n;
+        if (length == capacity) {
+            capacity *= 2;
+            buff = (char *) realloc (buff, capacity);
+            if (buff == NULL) {
+                perror ("realloc");
+                exit (EXIT_FAILURE);
+            }
+        }
+    }
+    if (length == 0) {
+        free (buff);
+        return NULL;
+    }
+    *size   = length;
+    *mapped = false;
+    return buff;
+}
+
+
+/*!
+ * load s-rec motrola format
+ * file is mapped and each data record is written into guest memory at once.
+ * records with broken checksum are skipped, and record count of S5/S6 is checked.
+ * \param fp   file pointer to be loaded srec
+ * \param env  environment to be load
+ * \return     max memory address to be loaded
+ */
+uint32_t LoadSrec (FILE *fp, riscvEnv env)
+{
+    size_t size;
+    bool   mapped;
+    char  *image = MapInputFile (fp, &size, &mapped);
+    if (image == NULL) {
+        return 0;
+    }
+
+    uint32_t pc_max = 0x00000000;
+    uint32_t data_records = 0;
+    uint32_t line_no = 0;
+    Byte_t   record[256];
+    const char *line = image;
+    const char *tail = image + size;
+
+    for (; line < tail; line_no++) {
+        const char *eol = (const char *) memchr (line, '\n', tail - line);
+        if (eol == NULL) {
+            eol = tail;
+        }
+        const char *next = eol + 1;
+        while (eol > line && (eol[-1] == '\r' || eol[-1] == ' ' || eol[-1] == '\t')) {
+            eol--;
+        }
+
+        if (eol - line < 4 || line[0] != 'S') { // not a s-record
+            line = next;
+            continue;
+        }
+        uint8_t type = line[1] - '0';
+        if (type > 9 || srec_addr_len[type] == 0) {
+            fprintf (stderr, "<Loading Srecord File : type is illegal %d>\n", type);
+            line = next;
+            continue;
+        }
+
+        // byte count, address, data and checksum
+        uint32_t byte_length;
+        if (DecodeHex (record, line + 2, 1) == false ||
+            (byte_length = record[0]) < srec_addr_len[type] + 1 ||
+            eol - line < 4 + byte_length * 2 ||
+            DecodeHex (record + 1, line + 4, byte_length) == false) {
+            fprintf (stderr, "<Loading Srecord File : line %u is broken>\n", line_no + 1);
+            line = next;
+            continue;
+        }
+        uint32_t sum = 0;
+        for (uint32_t i = 0; i <= byte_length; i++) {
+            sum += record[i];
+        }
+        if ((sum & 0xff) != 0xff) {
+            fprintf (stderr, "<Loading Srecord File : checksum error at line %u>\n", line_no + 1);
+            line = next;
+            continue;
+        }
+
+        uint32_t addr_len = srec_addr_len[type];
+        uint32_t address = 0;
+        for (uint32_t i = 0; i < addr_len; i++) {
+            address = (address << 8) | record[1 + i];
+        }
+
+        switch (type) {
+        case 1 :
+        case 2 :
+        case 3 : { // Data sequence
+            uint32_t data_len = byte_length - addr_len - 1;
+            AddLoadRange (address, data_len, env);
+            WriteMemoryImage (address, record + 1 + addr_len, data_len, env);
+            if (pc_max < address + data_len) {
+                pc_max = address + data_len;
+            }
+            data_records++;
+            break;
+        }
+        case 5 :
+        case 6 : // Record count
+            if (address != (data_records & ((1 << (addr_len * 8)) - 1))) {
+                fprintf (stderr, "<Loading Srecord File : record count is %u, but %u records are loaded>\n",
+                         address, data_records);
+            }
+            break;
+        default : // Block header, End of block
+            break;
+        }
+        line = next;
+    }
+
+    if (mapped == true) {
+        munmap (image, size);
+    } else {
+        free (image);
+    }
+    return pc_max;
+}
+
+
+/*!
+ * record address range written by loader
+ * range which continues the last one is merged into it.
+ * \param start  head address
+ * \param size   size in bytes
+ * \param env    environment
+ */
+void AddLoadRange (Addr_t start, uint32_t size, riscvEnv env)
+{
+    if (size == 0) {
+        return;
+    }
+    if (env->load_range_count > 0) {
+        loadRange *last = &env->load_ranges[env->load_range_count - 1];
+        if (last->start + last->size == start) {
+            last->size += size;
+            return;
+        }
+    }
+    if ((env->load_range_count & (env->load_range_count - 1)) == 0) {
+        uint32_t capacity = env->load_range_count == 0 ? 1 : env->load_range_count * 2;
+        env->load_ranges = (loadRange *) realloc (env->load_ranges, sizeof (loadRange) * capacity);
+        if (env->load_ranges == NULL) {
+            perror ("realloc");
+            exit (EXIT_FAILURE);
+        }
+    }
+    env->load_ranges[env->load_range_count].start = start;
+    env->load_ranges[env->load_range_count].size  = size;
+    env->load_range_count++;
+}
+
+
+/*!
+ * write program image into guest memory page by page, without trace.
+ * used by loaders before simulation, decoded instructions are not invalidated.
+ * \param addr  head address
+ * \param data  image to be written, zero-filled if NULL
+ * \param size  size in bytes
+ * \param env   environment
+ */
+void WriteMemoryImage (Addr_t addr, const Byte_t *data, uint32_t size, riscvEnv env)
+{
+    while (size > 0) {
+        uint32_t offset = addr & MEM_PAGE_MASK;
+        uint32_t length = MEM_PAGE_SIZE - offset;
+        if (length > size) {
+            length = size;
+        }
+        Byte_t *page = GetMemPage (env->memory, addr, true);
+        if (data != NULL) {
+            memcpy (page + offset, data, length);
+            data += length;
+        } else {
+            memset (page + offset, 0, length);
+        }
+        addr += length;
+        size -= length;
+    }
+}
+
+
+/*!
+ * list guest pages which hold data, in address order
+ * paged backend lists allocated pages. mmap backend lists pages resident
+ * in host and pages of loaded image, which may be mapped from file.
+ * \param env    environment
+ * \param count  number of listed pages
+ * \return       allocated array of page addresses
+ */
+Addr_t *ListTouchedPages (riscvEnv env, uint32_t *count)
+{
+    MemTable table = env->memory;
+    uint32_t capacity = 64;
+    Addr_t  *pages = (Addr_t *) checked_malloc (sizeof (Addr_t) * capacity);
+    uint32_t n = 0;
+
+#define PUSH_PAGE(addr) do {                                                    \
+        if (n == capacity) {                                                    \
+            capacity *= 2;                                                      \
+            pages = (Addr_t *) realloc (pages, sizeof (Addr_t) * capacity);    \
+            if (pages == NULL) {                                                \
+                perror ("realloc");                                             \
+                exit (EXIT_FAILURE);                                            \
+            }                                                                   \
+        }                                                                       \
+        pages[n++] = (addr);                                                    \
+    } while (0)
+
+    if (table->type == memTypeMmap) {
+        size_t page_num = MEM_SPACE_SIZE >> MEM_PAGE_BITS;
+        unsigned char *resident = (unsigned char *) checked_malloc (page_num);
+        if (mincore (table->base, MEM_SPACE_SIZE, resident) != 0) {
+            memset (resident, 1, page_num);   // every page has to be checked
+        }
+        for (uint32_t r = 0; r < env->load_range_count; r++) {
+            UDWord_t head = env->load_ranges[r].start >> MEM_PAGE_BITS;
+            UDWord_t last = ((UDWord_t)env->load_ranges[r].start + env->load_ranges[r].size - 1) >> MEM_PAGE_BITS;
+            for (UDWord_t p = head; p <= last; p++) {
+                resident[p] |= 1;
+            }
+        }
+        for (size_t p = 0; p < page_num; p++) {
+            if (resident[p] & 1) {
+                PUSH_PAGE ((Addr_t)(p << MEM_PAGE_BITS));
+            }
+        }
+        free (resident);
+    } else {
+        for (uint32_t d = 0; d < MEM_DIR_SIZE; d++) {
+            if (table->dir[d] == NULL) {
+                continue;
+            }
+            for (uint32_t t = 0; t < MEM_TABLE_SIZE; t++) {
+                if (table->dir[d][t] != NULL) {
+                    PUSH_PAGE ((d << (MEM_TABLE_BITS + MEM_PAGE_BITS)) | (t << MEM_PAGE_BITS));
+                }
+            }
+        }
+    }
+#undef PUSH_PAGE
+
+    *count = n;
+    return pages;
+}
+
+
+/*!
+ * forget dirty pages, following stores mark pages again.
+ * write tags of TLB are dropped since they skip marking.
+ * \param env  environment
+ */
+void ClearDirtyPages (riscvEnv env)
+{
+    memset (env->memory->dirty, 0, sizeof (uint64_t) * MEM_DIRTY_WORDS);
+    for (int i = 0; i < TLB_SIZE; i++) {
+        env->tlb[i].wtag = TLB_INVALID;
+    }
+}
+
+
+/*!
+ * find symbol which contains address
+ * symbol without size covers addresses up to the next symbol.
+ * \param addr  guest address
+ * \param env   environment
+ * \return      symbol, NULL if not found
+ */
+const guestSymbol *FindSymbol (Addr_t addr, riscvEnv env)
+{
+    uint32_t lo = 0, hi = env->symbol_count;
+    while (lo < hi) {   // first symbol above addr
+        uint32_t mid = (lo + hi) / 2;
+        if (env->symbols[mid].addr <= addr) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        return NULL;
+    }
+    const guestSymbol *sym = &env->symbols[lo - 1];
+    if (sym->size != 0 && addr - sym->addr >= sym->size) {
+        return NULL;
+    }
+    return sym;
+}
@@ -1,126 +1,304 @@
-/*
- * Copyright (c) 2015, Masayuki Kimura
- * All rights reserved.
- *
- *     Redistribution and use in source and binary forms, with or without
- *     modification, are permitted provided that the following conditions are met:
- *     * Redistributions of source code must retain the above copyright
- *     notice, this list of conditions and the following disclaimer.
- *     * Redistributions in binary form must reproduce the above copyright
- *     notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *     * Neither the name of the Masayuki Kimura nor the
- *       names of its contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
- *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#pragma once
-
-#include <stdio.h>
-#include "./basic.h"
-#include "./trace.h"
-
-typedef struct TAB_table_ *TAB_table;
-typedef        TAB_table   MemTable;
-
-#define TABSIZE 124147 // random factor value
-
-/*!
- * Basic Table structures
- */
-typedef struct binder_ *binder;
-struct binder_ {
-    void *key;
-    void *value;
-    binder next;
-    void *prevtop;
-};
-
-struct TAB_table_ {
-    binder table[TABSIZE];
-    void *top;
-};
-
-
-/*!
- * Architecture Environments
- */
-typedef struct __riscvEnv *riscvEnv;
-
-#define REG_R0  0
-#define REG_R31 31
-#define REG_PC  32
-
-struct __riscvEnv {
-    /*!
-     * Architecture Implementations
-     */
-    Word_t     regs[32];     // general register
-    Addr_t     pc;           // program counter
-    MemTable   memory;       // memory table
-
-    Addr_t     current_pc;   // PC before executing branch
-
-    /*!
-     * debug information
-     */
-    FILE     *dbgfp;        // file pointer for debugging output
-    uint32_t  start_time,   // for debug: performance counter start and stop
-              stop_time;
-    uint32_t  max_cycle;    // limit of simulation cycle
-    uint32_t  step;         // no of simulation step
-    traceInfo trace;        // trace information
-};
-
-
-/*!
- * === Basic Table Operations ===
- */
-TAB_table TAB_empty(void);
-void      TAB_enter(TAB_table t, void *key, void *value);
-void     *TAB_look(TAB_table t, void *key);
-
-
-/*!
- * === Memory Operations ===
- */
-MemTable CreateMemTable (void);
-void     InsertMemTable (MemTable, Addr_t, Byte_t);
-Byte_t   SearchMemTable (MemTable, Addr_t);
-
-
-/*!
- * === Architecture Environments ===
- */
-riscvEnv CreateNewRISCVEnv (FILE *fp);
-Word_t   GRegRead  (RegAddr_t, riscvEnv);
-void     GRegWrite (RegAddr_t, Word_t, riscvEnv);
-void     PCWrite (Addr_t, riscvEnv);
-Addr_t   PCRead (riscvEnv);
-Word_t   FetchMemory (Addr_t, riscvEnv);
-Word_t   LoadMemory  (Addr_t, Size_t, riscvEnv);
-void     StoreMemory (Addr_t, Word_t, Size_t, riscvEnv);
-void     AdvanceStep (riscvEnv);
-uint32_t LoadSrec (FILE *, riscvEnv);
-
-
-/*!
- * === Utilities
- */
-void    *checked_malloc (size_t);
-uint32_t ExtractBitField (uint32_t, uint32_t, uint32_t);
-uint32_t ExtractIField (uint32_t);
-uint32_t ExtractSBField (uint32_t);
-uint32_t ExtractUJField (uint32_t);
-uint32_t ExtendSign (uint32_t, uint32_t);
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdatomic.h>
+#include "./basic.h"
+#include "./trace.h"
+#include "./dec_cache.h"
+
+typedef struct __memTable   *MemTable;
+
+/*!
+ * Guest Memory structures
+ * memTypePaged : 32-bit guest address is split into directory / table / page offset.
+ *                Pages are allocated on first write, untouched memory reads as zero.
+ *                Pages can be shared between cloned tables, and are copied on
+ *                first write while reference count is more than 1.
+ * memTypeMmap  : whole 4 GiB guest space is reserved by one mmap, and kernel
+ *                zero-fills pages on demand. guest address is base + offset.
+ */
+#define MEM_PAGE_BITS   12
+#define MEM_TABLE_BITS  10
+#define MEM_DIR_BITS    (32 - MEM_TABLE_BITS - MEM_PAGE_BITS)
+
+#define MEM_PAGE_SIZE   (1 << MEM_PAGE_BITS)   // 4 KiB
+#define MEM_PAGE_MASK   (MEM_PAGE_SIZE - 1)
+#define MEM_TABLE_SIZE  (1 << MEM_TABLE_BITS)
+#define MEM_DIR_SIZE    (1 << MEM_DIR_BITS)
+
+#define MEM_SPACE_SIZE  (1ULL << 32)
+
+// reference count of paged page is placed after page data
+#define MEM_PAGE_REFS(page)  ((atomic_uint *)((page) + MEM_PAGE_SIZE))
+
+// one bit per guest page, set when page is written
+#define MEM_DIRTY_WORDS  ((MEM_SPACE_SIZE >> MEM_PAGE_BITS) / 64)
+
+typedef enum {memTypePaged,
+              memTypeMmap} memType;
+
+struct __memTable {
+    memType  type;
+    Byte_t  *base;                // head of reserved space (memTypeMmap)
+    Byte_t **dir[MEM_DIR_SIZE];   // directory of page tables (memTypePaged)
+    uint64_t *dirty;              // pages written since ClearDirtyPages
+};
+
+
+/*!
+ * Software TLB
+ * direct-mapped cache from guest page to host page.
+ * tag holds guest page address, TLB_INVALID never matches any lookup.
+ */
+#define TLB_BITS    8
+#define TLB_SIZE    (1 << TLB_BITS)
+#define TLB_INVALID MEM_PAGE_MASK
+
+typedef struct {
+    Addr_t  tag;     // guest page address
+    Addr_t  wtag;    // same as tag if page is writable and already dirty
+    Byte_t *page;    // host page
+} tlbEntry;
+
+
+/*!
+ * Stop Conditions of RunSimulation
+ * checked at block boundaries. breakpoint stops before the instruction.
+ */
+typedef enum {
+    stopNone = 0,
+    stopBudget,        // instruction budget is exhausted
+    stopBreakpoint,    // PC reached breakpoint
+    stopToHost,        // store to tohost address
+    stopExit,          // exit system call by ecall
+    stopTimeLimit      // wall-clock deadline
+} stopReason;
+
+typedef struct {
+    UDWord_t      max_steps;         // instruction budget, 0 is unlimited
+    const Addr_t *breakpoints;
+    uint32_t      breakpoint_count;
+    bool          tohost_enable;
+    Addr_t        tohost_addr;
+    bool          ecall_exit;        // stop on ecall with a7 = SYSCALL_EXIT
+    double        time_limit;        // wall-clock seconds, 0 is unlimited
+} stopConditions;
+
+#define SYSCALL_EXIT  93
+
+/*!
+ * Atomic memory operations of A extension
+ */
+typedef enum {
+    amoSwap = 0,
+    amoAdd,
+    amoXor,
+    amoAnd,
+    amoOr,
+    amoMin,
+    amoMax,
+    amoMinU,
+    amoMaxU
+} amoOp;
+
+/*!
+ * Address range written by program loader, [start, start + size)
+ */
+typedef struct {
+    Addr_t   start;
+    uint32_t size;
+} loadRange;
+
+/*!
+ * Symbol of guest program, kept by ELF loader for profiling and tracing
+ */
+typedef struct {
+    Addr_t      addr;
+    uint32_t    size;   // 0 if unknown
+    const char *name;
+} guestSymbol;
+
+
+/*!
+ * Execution engine used by RunSimulation
+ */
+typedef enum {
+    execModeLog,         // step with text log
+    execModeNoTrace,     // step without trace
+    execModeBinTrace,    // step with binary trace
+    execModeAsyncLog,    // step with text log formatted by threads
+    execModeBlock        // basic blocks (and JIT)
+} execMode;
+
+
+/*!
+ * Architecture Environments
+ */
+typedef struct __riscvEnv *riscvEnv;
+
+#define REG_R0  0
+#define REG_R31 31
+#define REG_PC  32
+
+struct __riscvEnv {
+    /*!
+     * Architecture Implementations
+     */
+    Word_t     regs[32];     // general register
+    Addr_t     pc;           // program counter
+    uint32_t   hart_id;      // index of hart in hart group, 0 for single hart
+    MemTable   memory;       // memory table, shared by harts in group
+    tlbEntry   tlb[TLB_SIZE];  // software TLB in front of memory table
+    decodedInst *dec_cache;  // pre-decoded instruction cache
+    struct __blockCache *block_cache;  // basic blocks, created by block engine
+    struct __jitCache   *jit_cache;    // translated code, NULL if JIT is disabled
+
+    Addr_t     current_pc;   // PC before executing branch
+    uint32_t   inst_len;     // length of current instruction, 2 if compressed
+
+    bool       reserve_valid;  // reservation of LR.W is held
+    Addr_t     reserve_addr;   // address reserved by LR.W
+    Word_t     reserve_value;  // value loaded by LR.W
+
+    loadRange *load_ranges;  // ranges of program image, in loaded order
+    uint32_t   load_range_count;
+    guestSymbol *symbols;    // sorted by address, NULL if image has no symbol table
+    uint32_t   symbol_count;
+    char      *symbol_names;   // storage of names, NULL if symbols are borrowed from other environment
+
+    MemTable   ckpt_base;    // pages at last checkpoint, shared copy-on-write (paged only)
+    UDWord_t   ckpt_step;    // step of last checkpoint
+    bool       ckpt_taken;   // delta checkpoint is available
+
+    /*!
+     * debug information
+     */
+    FILE     *dbgfp;        // file pointer for debugging output
+    uint32_t  start_time,   // for debug: performance counter start and stop
+              stop_time;
+    UDWord_t  max_cycle;    // limit of simulation cycle
+    UDWord_t  step;         // no of simulation step
+    traceInfo trace;        // trace information
+    execMode  exec_mode;    // engine of RunSimulation
+    FILE     *trace_fp;     // binary trace for execModeBinTrace
+    struct __logWriter *log_writer;  // for execModeAsyncLog
+
+    /*!
+     * stop conditions
+     */
+    const stopConditions *stop;  // conditions of current RunSimulation
+    stopReason stop_reason; // set when simulation should stop
+    Word_t    exit_code;    // exit code of guest program
+
+    /*!
+     * statistics
+     */
+    UDWord_t  tlb_hit;      // number of TLB hit
+    UDWord_t  tlb_miss;     // number of TLB miss
+    UDWord_t  dec_hit;      // number of decode cache hit
+    UDWord_t  dec_miss;     // number of decode cache miss
+};
+
+
+/*!
+ * === Memory Operations ===
+ */
+MemTable CreateMemTable (memType);
+MemTable CloneMemTable (MemTable);
+void     DestroyMemTable (MemTable);
+static inline bool IsDirtyPage (MemTable table, Addr_t addr)
+{
+    uint32_t page = addr >> MEM_PAGE_BITS;
+    return (table->dirty[page / 64] >> (page % 64)) & 1;
+}
+Byte_t  *GetMemPage     (MemTable, Addr_t, bool);
+
+
+/*!
+ * === Architecture Environments ===
+ */
+riscvEnv CreateNewRISCVEnv (FILE *fp, memType);
+riscvEnv CloneRISCVEnv (riscvEnv);
+void     DestroyRISCVEnv (riscvEnv);
+Word_t   GRegRead  (RegAddr_t, riscvEnv);
+void     GRegWrite (RegAddr_t, Word_t, riscvEnv);
+void     PCWrite (Addr_t, riscvEnv);
+Addr_t   PCRead (riscvEnv);
+Word_t   FetchMemory (Addr_t, riscvEnv);
+Word_t   LoadMemory  (Addr_t, Size_t, riscvEnv);
+void     StoreMemory (Addr_t, Word_t, Size_t, riscvEnv);
+Word_t   LoadMemoryNoTrace  (Addr_t, Size_t, riscvEnv);
+void     StoreMemoryNoTrace (Addr_t, Word_t, Size_t, riscvEnv);
+Word_t   AtomicMemory (Addr_t, amoOp, Word_t, riscvEnv);
+Word_t   AtomicMemoryNoTrace (Addr_t, amoOp, Word_t, riscvEnv);
+Word_t   LoadReserved (Addr_t, riscvEnv);
+Word_t   LoadReservedNoTrace (Addr_t, riscvEnv);
+bool     StoreConditional (Addr_t, Word_t, riscvEnv);
+bool     StoreConditionalNoTrace (Addr_t, Word_t, riscvEnv);
+void     AdvanceStep (riscvEnv);
+void     FlushTLB (riscvEnv);
+bool     IsBreakpoint (Addr_t, riscvEnv);
+uint32_t LoadSrec (FILE *, riscvEnv);
+void     AddLoadRange (Addr_t, uint32_t, riscvEnv);
+void     WriteMemoryImage (Addr_t, const Byte_t *, uint32_t, riscvEnv);
+Addr_t  *ListTouchedPages (riscvEnv, uint32_t *);
+void     ClearDirtyPages (riscvEnv);
+const guestSymbol *FindSymbol (Addr_t, riscvEnv);
+
+
+/*!
+ * === Utilities
+ */
+void    *checked_malloc (size_t);
+uint32_t ExtractBitField (uint32_t, uint32_t, uint32_t);
+
+
+/*!
+ * === Accessors without trace recording ===
+ * used by instruction handlers built with SIM_NOTRACE.
+ * PC write still marks branch, since AdvanceStep depends on it.
+ */
+static inline Word_t GRegReadNoTrace (RegAddr_t reg, riscvEnv env)
+{
+    return env->regs [reg];
+}
+
+static inline void GRegWriteNoTrace (RegAddr_t reg, Word_t data, riscvEnv env)
+{
+    if (reg != 0x00) {
+        env->regs [reg] = data;
+    }
+}
+
+static inline void PCWriteNoTrace (Addr_t addr, riscvEnv env)
+{
+    env->trace->isbranch = true;
+    env->pc = addr;
+}
@@ -1,358 +1,775 @@
-#!/bin/ruby
-#
-# Copyright (c) 2015, Masayuki Kimura
-# All rights reserved.
-#
-#     Redistribution and use in source and binary forms, with or without
-#     modification, are permitted provided that the following conditions are met:
-#     * Redistributions of source code must retain the above copyright
-#     notice, this list of conditions and the following disclaimer.
-#     * Redistributions in binary form must reproduce the above copyright
-#     notice, this list of conditions and the following disclaimer in the
-#       documentation and/or other materials provided with the distribution.
-#     * Neither the name of the Masayuki Kimura nor the
-#       names of its contributors may be used to endorse or promote products
-#       derived from this software without specific prior written permission.
-#
-# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-#     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-# DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
-#     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-#     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-#      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-#     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-#     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-#     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-#
-
-require './riscv_arch_table.rb'
-
-##=== displaying headers ===
-
-def gen_header(fp)
-  fp.puts("/*")
-  fp.puts(" * Copyright (c) 2015, Masayuki Kimura")
-  fp.puts(" * All rights reserved.")
-  fp.puts(" *")
-  fp.puts(" *     Redistribution and use in source and binary forms, with or without")
-  fp.puts(" *     modification, are permitted provided that the following conditions are met:")
-  fp.puts(" *     * Redistributions of source code must retain the above copyright")
-  fp.puts(" *     notice, this list of conditions and the following disclaimer.")
-  fp.puts(" *     * Redistributions in binary form must reproduce the above copyright")
-  fp.puts(" *     notice, this list of conditions and the following disclaimer in the")
-  fp.puts(" *       documentation and/or other materials provided with the distribution.")
-  fp.puts(" *     * Neither the name of the Masayuki Kimura nor the")
-  fp.puts(" *       names of its contributors may be used to endorse or promote products")
-  fp.puts(" *       derived from this software without specific prior written permission.")
-  fp.puts(" *")
-  fp.puts(" * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\" AND")
-  fp.puts(" *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED")
-  fp.puts(" * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE")
-  fp.puts(" * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY")
-  fp.puts(" *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES")
-  fp.puts(" *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;")
-  fp.puts(" *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND")
-  fp.puts(" *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT")
-  fp.puts(" *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS")
-  fp.puts(" *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.")
-  fp.puts(" */")
-  fp.puts("")
-  fp.puts("/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */")
-  fp.puts("")
-  fp.puts("")
-end
-
-
-def get_key_idx(key)
-  case key
-  when 'R3'
-    return ARCH::R3
-  when 'F2'
-    return ARCH::F2
-  when 'R2'
-    return ARCH::R2
-  when 'R1'
-    return ARCH::R1
-  when 'F3'
-    return ARCH::F3
-  when 'RD'
-    return ARCH::RD
-  when 'OP'
-    return ARCH::OP
-  else
-    printf("ERROR: can't find key %s\n", key)
-    return -1
-  end
-end
-
-
-module DEC
-  FUNC_STR = ARCH::TAIL
-  CURR_DEC = ARCH::TAIL + 1
-  INST_NAME = ARCH::TAIL + 2
-end
-
-func_str = "Dec_RISCV"
-inst_name = Array[]
-temp_arch_table = Array[]
-
-
-##
-## === Architecture Operand Type Declaration ===
-##
-
-operand_type_array = Array[]
-operand_type_array[0] = ["h",  "operandTypeHex"]
-operand_type_array[1] = ["d",  "operandTypeDec"]
-operand_type_array[2] = ["sb", "operandTypeSB"]
-operand_type_array[3] = ["uj", "operandTypeUJ"]
-
-
-##
-##=== making instruction define list ===
-##
-
-inst_define_fp = File.open('inst_list.h', 'w')
-
-gen_header(inst_define_fp) # making header
-inst_define_fp.puts("#pragma once")
-inst_define_fp.puts("")
-inst_define_fp.puts("")
-
-# generate instruction list
-$arch_table.each_with_index {|inst_info, index|
-  mnemonic = "INST_%s"%([inst_info[ARCH::NAME].split(" ")[0].gsub(/\./,'_').upcase])
-  $arch_table[index][DEC::INST_NAME] = mnemonic
-  $arch_table[index][DEC::FUNC_STR] = "RISCV_DEC"
-  mne_str = "#define %s\t\t%d"%([mnemonic, index])
-  inst_define_fp.puts(mne_str)
-}
-
-
-##
-##=== generate decode table ===
-##
-inst_decoder_c_fp = File.open('inst_decoder.c', 'w')
-inst_decoder_h_fp = File.open('inst_decoder.h', 'w')
-
-gen_header(inst_decoder_c_fp) # making header
-gen_header(inst_decoder_h_fp) # making header
-
-inst_decoder_c_fp.puts("#include <stdint.h>")
-inst_decoder_c_fp.puts("#include \"./inst_list.h\"")
-inst_decoder_c_fp.puts("#include \"./inst_decoder.h\"")
-inst_decoder_c_fp.puts("#include \"./dec_utils.h\"\n\n\n")
-
-inst_decoder_h_fp.puts("#include <stdint.h>")
-inst_decoder_h_fp.puts("#include \"./inst_list.h\"")
-inst_decoder_h_fp.puts("#include \"./dec_utils.h\"\n\n\n")
-
-$arch_table.each {|inst_info| temp_arch_table.push(inst_info) }
-
-#== generate decode table ==
-
-until temp_arch_table.size == 0
-  target_func_str = temp_arch_table[0][DEC::FUNC_STR]
-
-  # declare function
-  inst_decoder_c_fp.printf("uint32_t %s (uint32_t inst_hex)\n", target_func_str)
-  inst_decoder_c_fp.puts("{\n")
-  # declare function headers
-  inst_decoder_h_fp.printf("uint32_t %s (uint32_t inst_hex);\n", target_func_str)
-
-  temp_arch_table.each_with_index {|inst_info, index|
-    if inst_info[DEC::FUNC_STR] == target_func_str then
-      key_table = inst_info[ARCH::KEY_TABLE]
-      key_idx   = get_key_idx(key_table[0])
-      dec       = inst_info[key_idx]
-
-      if key_table.size == 1 then
-        inst_decoder_c_fp.printf("    if (Extract%sField (inst_hex) == 0x%02x)\n", key_table[0], inst_info[key_idx].to_i(2))
-        inst_decoder_c_fp.printf("        return %s;\n", inst_info[DEC::INST_NAME])
-      else # need to more decode
-        temp_arch_table[index][DEC::CURR_DEC] = dec
-      end
-    end
-  }
-
-  dec_table = Array[]
-  # generate next decode table
-  # shrinking same decode-table
-  temp_arch_table.each_with_index {|inst_info, index|
-    if inst_info[DEC::FUNC_STR] == target_func_str then
-      key_table = inst_info[ARCH::KEY_TABLE]
-      key_idx   = get_key_idx(key_table[0])
-      func_str = "%s_%s_0x%x"%([inst_info[DEC::FUNC_STR], key_table[0], inst_info[key_idx].to_i(2)])
-
-      if key_table.size != 1 then
-        if not dec_table.include?(func_str) then
-          dec_table.push(func_str)
-          inst_decoder_c_fp.printf("    if (Extract%sField (inst_hex) == 0x%02x)\n", key_table[0], inst_info[key_idx].to_i(2))
-          inst_decoder_c_fp.printf("        return %s (inst_hex);\n", func_str)
-        end
-        temp_arch_table[index][DEC::FUNC_STR] = func_str
-        temp_arch_table[index][ARCH::KEY_TABLE].delete_at(0)
-      end
-    end
-  }
-
-  inst_decoder_c_fp.printf("    return -1;\n");
-
-  # finally decode-finished entry is deleted.
-  temp_arch_table.delete_if {|inst_info| inst_info[DEC::FUNC_STR] == target_func_str }
-
-  inst_decoder_c_fp.puts("}\n\n\n")
-end  # temp_arch_table.size == 0
-
-
-##
-##=== generate function table ===
-##
-
-inst_func_fp = File.open('inst_riscv.h', 'w')
-gen_header(inst_func_fp) # making header
-inst_func_fp.puts("#pragma once")
-inst_func_fp.puts("")
-inst_func_fp.puts("")
-
-inst_func_fp.puts("#include <stdint.h>")
-inst_func_fp.puts("#include \"./env.h\"\n")
-inst_func_fp.puts("#include \"./inst_list.h\"\n")
-inst_func_fp.puts("#include \"./dec_utils.h\"\n\n\n")
-
-$arch_table.each {|inst_info|
-  inst_func_fp.printf("void RISCV_%s (uint32_t inst_hex, riscvEnv env);\n", inst_info[DEC::INST_NAME]);
-}
-
-
-##
-##=== generate function call array ===
-##
-inst_array_fp = File.open('inst_call.c', 'w')
-gen_header(inst_array_fp) # making header
-inst_array_fp.puts("")
-inst_array_fp.puts("")
-
-inst_array_fp.puts("#include <stdint.h>")
-inst_array_fp.puts("#include \"./env.h\"\n")
-inst_array_fp.puts("#include \"./inst_riscv.h\"\n")
-
-inst_array_fp.puts("void (* const inst_exec_func[])(uint32_t, riscvEnv) = {\n");
-$arch_table.each_with_index {|inst_info, index|
-  inst_array_fp.printf("    RISCV_%s", inst_info[DEC::INST_NAME]);
-  if (index == $arch_table.size-1) then
-    inst_array_fp.puts("\n};");
-  else
-    inst_array_fp.puts(",\n");
-  end
-}
-
-inst_array_fp.close()
-
-
-##
-##=== generate instruction print table ===
-##
-inst_mnemonic_c_fp = File.open('./inst_mnemonic.c', 'w')
-
-gen_header(inst_mnemonic_c_fp) # making header
-
-inst_mnemonic_c_fp.puts("#pragma once")
-inst_mnemonic_c_fp.puts("")
-inst_mnemonic_c_fp.puts("")
-inst_mnemonic_c_fp.puts("#include \"./inst_list.h\"")
-inst_mnemonic_c_fp.puts("#include \"./dec_utils.h\"\n\n\n")
-
-inst_mnemonic_c_fp.printf("char *inst_strings[%d] = {\n", $arch_table.size);
-$arch_table.each_with_index {|inst_info, index|
-  inst_string = inst_info[ARCH::NAME].gsub(/\w+\[\d+:\d+\]/, "@")
-  inst_mnemonic_c_fp.printf("    \"%s\"", inst_string)
-  if index != $arch_table.size - 1 then
-    inst_mnemonic_c_fp.puts(",\n")
-  end
-}
-inst_mnemonic_c_fp.puts("};\n");
-
-inst_mnemonic_c_fp.close()
-
-
-##
-##=== generate operand table ===
-##
-inst_operand_h_fp = File.open('./inst_operand.h', 'w');
-
-gen_header(inst_operand_h_fp)  # making header
-
-inst_operand_h_fp.puts("#pragma once")
-inst_operand_h_fp.puts("")
-inst_operand_h_fp.puts("")
-inst_operand_h_fp.puts("#include <stdint.h>")
-inst_operand_h_fp.puts("#include \"./inst_list.h\"")
-inst_operand_h_fp.puts("#include \"./dec_utils.h\"\n\n\n")
-
-inst_operand_h_fp.puts("typedef enum {");
-operand_type_array.each_with_index {|operand_type, index|
-  inst_operand_h_fp.printf("      %s = %d", operand_type[1], index)
-  if index != operand_type_array.size - 1 then
-    inst_operand_h_fp.puts(", ")
-  end
-}
-inst_operand_h_fp.puts(" } operandType;")
-
-inst_operand_h_fp.puts("")
-
-inst_operand_h_fp.puts("#define MAX_OPERANDS 8\n\n");
-inst_operand_h_fp.puts("typedef struct {\n");
-inst_operand_h_fp.puts("    uint32_t size;\n");
-inst_operand_h_fp.puts("    operandType type_lst[MAX_OPERANDS];\n");
-inst_operand_h_fp.puts("    uint32_t msb_lst[MAX_OPERANDS];\n");
-inst_operand_h_fp.puts("    uint32_t lsb_lst[MAX_OPERANDS];\n");
-inst_operand_h_fp.puts("} operandList;\n");
-
-
-
-inst_operand_c_fp = File.open('./inst_operand.c', 'w');
-
-gen_header(inst_operand_c_fp)  # making header
-
-inst_operand_c_fp.puts("#pragma once")
-inst_operand_c_fp.puts("")
-inst_operand_c_fp.puts("")
-inst_operand_c_fp.puts("#include <stdint.h>")
-inst_operand_c_fp.puts("#include \"./inst_list.h\"")
-inst_operand_c_fp.puts("#include \"./inst_operand.h\"\n\n\n")
-
-inst_operand_c_fp.printf("operandList inst_operand[%d];\n\n\n", $arch_table.size)
-inst_operand_c_fp.printf("FormatOperand ()\n{\n");
-
-
-
-$arch_table.each_with_index {|inst_info, index|
-  operand = inst_info[ARCH::NAME].scan(/\w+\[\d+:\d+\]/)
-  inst_name = $arch_table[index][DEC::INST_NAME]
-  inst_operand_c_fp.printf("    // %s\n", inst_name)
-  inst_operand_c_fp.printf("    inst_operand[%s].size = %d;\n", inst_name, operand.size)
-  operand.each_with_index {|bit_field, op_index|
-    msb_lst = bit_field.match(/\w+\[(\d+):\d+\]/)
-    msb_bit = msb_lst[1]
-    msb_lst = bit_field.match(/\w+\[\d+:(\d+)\]/)
-    lsb_bit = msb_lst[1]
-    msb_lst = bit_field.match(/(\w+)\[\d+:\d+\]/)
-    type_bit = msb_lst[1]
-    operand_type_str = String
-    operand_type_array.each_with_index {|operand_type, index|
-      if operand_type[0] == type_bit then
-        operand_type_str = operand_type[1]
-        break
-      end
-    }
-    inst_operand_c_fp.printf("    inst_operand[%s].type_lst[%d] = %s;\n", inst_name, op_index, operand_type_str)
-    inst_operand_c_fp.printf("    inst_operand[%s].msb_lst[%d] = %d;\n", inst_name, op_index, msb_bit)
-    inst_operand_c_fp.printf("    inst_operand[%s].lsb_lst[%d] = %d;\n", inst_name, op_index, lsb_bit)
-  }
-}
-
-inst_operand_c_fp.printf("}\n")
-
-inst_operand_c_fp.close()
+#!/bin/ruby
+#
+# Copyright (c) 2015, Masayuki Kimura
+# All rights reserved.
+#
+#     Redistribution and use in source and binary forms, with or without
+#     modification, are permitted provided that the following conditions are met:
+#     * Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the name of the Masayuki Kimura nor the
+#       names of its contributors may be used to endorse or promote products
+#       derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+#     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+#     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+#     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+#      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+#     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+require './riscv_arch_table.rb'
+
+##=== displaying headers ===
+
+def gen_header(fp)
+  fp.puts("/*")
+  fp.puts(" * Copyright (c) 2015, Masayuki Kimura")
+  fp.puts(" * All rights reserved.")
+  fp.puts(" *")
+  fp.puts(" *     Redistribution and use in source and binary forms, with or without")
+  fp.puts(" *     modification, are permitted provided that the following conditions are met:")
+  fp.puts(" *     * Redistributions of source code must retain the above copyright")
+  fp.puts(" *     notice, this list of conditions and the following disclaimer.")
+  fp.puts(" *     * Redistributions in binary form must reproduce the above copyright")
+  fp.puts(" *     notice, this list of conditions and the following disclaimer in the")
+  fp.puts(" *       documentation and/or other materials provided with the distribution.")
+  fp.puts(" *     * Neither the name of the Masayuki Kimura nor the")
+  fp.puts(" *       names of its contributors may be used to endorse or promote products")
+  fp.puts(" *       derived from this software without specific prior written permission.")
+  fp.puts(" *")
+  fp.puts(" * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\" AND")
+  fp.puts(" *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED")
+  fp.puts(" * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE")
+  fp.puts(" * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY")
+  fp.puts(" *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES")
+  fp.puts(" *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;")
+  fp.puts(" *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND")
+  fp.puts(" *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT")
+  fp.puts(" *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS")
+  fp.puts(" *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.")
+  fp.puts(" */")
+  fp.puts("")
+  fp.puts("/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */")
+  fp.puts("")
+  fp.puts("")
+end
+
+
+def get_key_idx(key)
+  case key
+  when 'R3'
+    return ARCH::R3
+  when 'F2'
+    return ARCH::F2
+  when 'R2'
+    return ARCH::R2
+  when 'R1'
+    return ARCH::R1
+  when 'F3'
+    return ARCH::F3
+  when 'RD'
+    return ARCH::RD
+  when 'OP'
+    return ARCH::OP
+  else
+    printf("ERROR: can't find key %s\n", key)
+    return -1
+  end
+end
+
+
+module DEC
+  INST_NAME = ARCH::TAIL
+end
+
+inst_name = Array[]
+
+
+##
+## === Architecture Operand Type Declaration ===
+##
+
+operand_type_array = Array[]
+operand_type_array[0] = ["h",  "operandTypeHex"]
+operand_type_array[1] = ["d",  "operandTypeDec"]
+operand_type_array[2] = ["sb", "operandTypeSB"]
+operand_type_array[3] = ["uj", "operandTypeUJ"]
+
+
+##
+##=== making instruction define list ===
+##
+
+inst_define_fp = File.open('inst_list.h', 'w')
+
+gen_header(inst_define_fp) # making header
+inst_define_fp.puts("#pragma once")
+inst_define_fp.puts("")
+inst_define_fp.puts("")
+
+# generate instruction list
+$arch_table.each_with_index {|inst_info, index|
+  mnemonic = "INST_%s"%([inst_info[ARCH::NAME].split(" ")[0].gsub(/\./,'_').upcase])
+  $arch_table[index][DEC::INST_NAME] = mnemonic
+  mne_str = "#define %s\t\t%d"%([mnemonic, index])
+  inst_define_fp.puts(mne_str)
+}
+
+
+##
+##=== generate decode table ===
+##
+## The decoder is a tree of lookup tables. Each node indexes one field
+## (OP, F3, F2, R3, ...) and each entry is an instruction index, a
+## reference to the next node, or DEC_ILLEGAL. When the instructions
+## under a node are keyed on different fields, the node becomes a chain
+## of tables: a value which matches nothing in one table falls through
+## to the next one, in the same order as the keys appear in $arch_table.
+##
+
+$dec_nodes   = Array[]   # [node name, key, first entry]
+$dec_entries = Array[]
+
+DEC_NODE_FLAG = 0x8000
+
+def get_key_field(key)
+  case key
+  when 'R3' then return [27, 5]
+  when 'F2' then return [25, 2]
+  when 'R2' then return [20, 5]
+  when 'R1' then return [15, 5]
+  when 'F3' then return [12, 3]
+  when 'RD' then return [ 7, 5]
+  when 'OP' then return [ 0, 7]
+  else
+    printf("ERROR: can't find key %s\n", key)
+    return [0, 0]
+  end
+end
+
+def dec_key_value(index, key)
+  return $arch_table[index][get_key_idx(key)].to_i(2)
+end
+
+# insts is an array of [arch_table index, remaining keys]
+def gen_dec_node(name, insts)
+  tests = Array[]
+  # instructions decided by this node are tested first ...
+  insts.each {|index, keys|
+    if keys.size == 1 then
+      tests.push([keys[0], dec_key_value(index, keys[0]), index])
+    end
+  }
+  # ... then the ones which need more decoding
+  children = Hash.new
+  insts.each {|index, keys|
+    if keys.size != 1 then
+      child_key = [keys[0], dec_key_value(index, keys[0])]
+      children[child_key] = Array[] if not children.key?(child_key)
+      children[child_key].push([index, keys[1..-1]])
+    end
+  }
+  children.each {|(key, value), child_insts| tests.push([key, value, child_insts]) }
+
+  groups = tests.chunk {|test| test[0] }.to_a
+  first_node = $dec_nodes.size
+  groups.each_with_index {|(key, group_tests), group_idx|
+    lsb, width = get_key_field(key)
+    $dec_nodes.push(["%s_%s"%([name, key]), key, $dec_entries.size])
+    $dec_entries.concat(Array.new(1 << width, nil))
+  }
+
+  groups.each_with_index {|(key, group_tests), group_idx|
+    lsb, width = get_key_field(key)
+    base = $dec_nodes[first_node + group_idx][2]
+    group_tests.each {|test_key, value, target|
+      if $dec_entries[base + value].nil? then
+        if target.is_a?(Array) then
+          child_name = "%s_%s_0x%x"%([name, key, value])
+          $dec_entries[base + value] = "DEC_NODE(%d)"%([gen_dec_node(child_name, target)])
+        else
+          $dec_entries[base + value] = $arch_table[target][DEC::INST_NAME]
+        end
+      end
+    }
+    fall_through = (group_idx + 1 < groups.size) ? "DEC_NODE(%d)"%([first_node + group_idx + 1]) : "DEC_ILLEGAL"
+    (0...(1 << width)).each {|value|
+      $dec_entries[base + value] = fall_through if $dec_entries[base + value].nil?
+    }
+  }
+  return first_node
+end
+
+def dec_node_depth(node)
+  depth = 0
+  key, base = $dec_nodes[node][1], $dec_nodes[node][2]
+  lsb, width = get_key_field(key)
+  $dec_entries[base, 1 << width].each {|entry|
+    if entry =~ /DEC_NODE\((\d+)\)/ then
+      depth = [depth, dec_node_depth($1.to_i)].max
+    end
+  }
+  return depth + 1
+end
+
+dec_insts = Array[]
+$arch_table.each_with_index {|inst_info, index| dec_insts.push([index, inst_info[ARCH::KEY_TABLE]]) }
+gen_dec_node("RISCV_DEC", dec_insts)
+
+if $dec_entries.size >= 0x10000 or $dec_nodes.size >= DEC_NODE_FLAG or $arch_table.size >= DEC_NODE_FLAG then
+  printf("ERROR: decode table is too large (%d nodes, %d entries)\n", $dec_nodes.size, $dec_entries.size)
+end
+
+inst_decoder_c_fp = File.open('inst_decoder.c', 'w')
+inst_decoder_h_fp = File.open('inst_decoder.h', 'w')
+
+gen_header(inst_decoder_c_fp) # making header
+gen_header(inst_decoder_h_fp) # making header
+
+inst_decoder_h_fp.puts("#pragma once")
+inst_decoder_h_fp.puts("")
+inst_decoder_h_fp.puts("#include <stdint.h>")
+inst_decoder_h_fp.puts("#include \"./inst_list.h\"")
+inst_decoder_h_fp.puts("#include \"./dec_utils.h\"\n\n\n")
+inst_decoder_h_fp.puts("/*!")
+inst_decoder_h_fp.puts(" * Decode an instruction word.")
+inst_decoder_h_fp.puts(" * \\return index of the instruction (INST_XXX), -1 if illegal.")
+inst_decoder_h_fp.puts(" */")
+inst_decoder_h_fp.puts("uint32_t RISCV_DEC (uint32_t inst_hex);")
+inst_decoder_h_fp.puts("")
+inst_decoder_h_fp.puts("/*!")
+inst_decoder_h_fp.puts(" * Expand a 16-bit compressed instruction into the 32-bit instruction.")
+inst_decoder_h_fp.puts(" * \\return 32-bit instruction, 0 if illegal (RISCV_DEC(0) is illegal).")
+inst_decoder_h_fp.puts(" */")
+inst_decoder_h_fp.puts("uint32_t RISCV_EXPAND_RVC (uint32_t inst_hex);")
+
+inst_decoder_c_fp.puts("#include <stdint.h>")
+inst_decoder_c_fp.puts("#include \"./inst_list.h\"")
+inst_decoder_c_fp.puts("#include \"./inst_decoder.h\"\n\n\n")
+
+inst_decoder_c_fp.puts("#define DEC_ILLEGAL   (0xffff)")
+inst_decoder_c_fp.printf("#define DEC_NODE_FLAG (0x%04x)\n", DEC_NODE_FLAG)
+inst_decoder_c_fp.puts("#define DEC_NODE(n)   (DEC_NODE_FLAG | (n))")
+inst_decoder_c_fp.printf("#define DEC_MAX_DEPTH (%d)\n\n", dec_node_depth(0))
+
+inst_decoder_c_fp.puts("typedef struct {")
+inst_decoder_c_fp.puts("    uint8_t  shift;")
+inst_decoder_c_fp.puts("    uint8_t  mask;")
+inst_decoder_c_fp.puts("    uint16_t base;   // first entry in dec_entries[]")
+inst_decoder_c_fp.puts("} decNode;\n\n")
+
+inst_decoder_c_fp.puts("static const decNode dec_nodes[] = {")
+$dec_nodes.each_with_index {|(name, key, base), node|
+  lsb, width = get_key_field(key)
+  inst_decoder_c_fp.printf("    { %2d, 0x%02x, %5d },  // %3d : %s\n", lsb, (1 << width) - 1, base, node, name)
+}
+inst_decoder_c_fp.puts("};\n\n")
+
+inst_decoder_c_fp.puts("static const uint16_t dec_entries[] = {")
+$dec_nodes.each_with_index {|(name, key, base), node|
+  lsb, width = get_key_field(key)
+  inst_decoder_c_fp.printf("    // %d : %s\n", node, name)
+  $dec_entries[base, 1 << width].each_slice(4) {|slice|
+    inst_decoder_c_fp.printf("    %s,\n", slice.map {|entry| "%-16s"%([entry]) }.join(", ").rstrip)
+  }
+}
+inst_decoder_c_fp.puts("};\n\n\n")
+
+inst_decoder_c_fp.puts("uint32_t RISCV_DEC (uint32_t inst_hex)")
+inst_decoder_c_fp.puts("{")
+inst_decoder_c_fp.puts("    uint32_t node = 0;")
+inst_decoder_c_fp.puts("    for (uint32_t depth = 0; depth < DEC_MAX_DEPTH; depth++) {")
+inst_decoder_c_fp.puts("        const decNode *dec = &dec_nodes[node];")
+inst_decoder_c_fp.puts("        uint16_t entry = dec_entries[dec->base + ((inst_hex >> dec->shift) & dec->mask)];")
+inst_decoder_c_fp.puts("        if (entry == DEC_ILLEGAL) {")
+inst_decoder_c_fp.puts("            return -1;")
+inst_decoder_c_fp.puts("        }")
+inst_decoder_c_fp.puts("        if (!(entry & DEC_NODE_FLAG)) {")
+inst_decoder_c_fp.puts("            return entry;")
+inst_decoder_c_fp.puts("        }")
+inst_decoder_c_fp.puts("        node = entry & ~DEC_NODE_FLAG;")
+inst_decoder_c_fp.puts("    }")
+inst_decoder_c_fp.puts("    return -1;")
+inst_decoder_c_fp.puts("}")
+
+
+##
+##=== generate expander of compressed instructions ===
+##
+## entries of $rvc_table are grouped by quadrant and funct3, and tested
+## in table order. fixed bits of the expanded instruction come from
+## $arch_table, operands are placed by the format of its major opcode.
+##
+rvc_imm_encode = Hash[
+  'I'  => "((imm & 0xfff) << 20)",
+  'S'  => "((imm & 0xfe0) << 20) | ((imm & 0x01f) << 7)",
+  'SB' => "((imm & 0x1000) << 19) | ((imm & 0x7e0) << 20) | ((imm & 0x01e) << 7) | ((imm & 0x800) >> 4)",
+  'U'  => "(imm & 0xfffff000)",
+  'UJ' => "((imm & 0x100000) << 11) | ((imm & 0x7fe) << 20) | ((imm & 0x800) << 9) | (imm & 0xff000)",
+]
+rvc_reg_shift = Hash['rd' => 7, 'rs1' => 15, 'rs2' => 20]
+
+def rvc_reg_field(field)
+  if field.is_a?(Integer) then
+    return "%d"%([field])
+  elsif field.size == 3 then
+    return "(((inst_hex >> %d) & 0x07) + %d)"%([field[1], field[2]])
+  else
+    return "((inst_hex >> %d) & 0x1f)"%([field[1]])
+  end
+end
+
+rvc_groups = Hash.new
+$rvc_table.each {|rvc_info|
+  bits = rvc_info[RVC::PATTERN]
+  group = (bits[0, 3].to_i(2) << 2) | bits[14, 2].to_i(2)
+  rvc_groups[group] = Array[] if not rvc_groups.key?(group)
+  rvc_groups[group].push(rvc_info)
+}
+
+inst_decoder_c_fp.puts("\n\n")
+inst_decoder_c_fp.puts("uint32_t RISCV_EXPAND_RVC (uint32_t inst_hex)")
+inst_decoder_c_fp.puts("{")
+inst_decoder_c_fp.puts("    uint32_t imm;")
+inst_decoder_c_fp.puts("")
+inst_decoder_c_fp.puts("    switch (((inst_hex >> 11) & 0x1c) | (inst_hex & 0x03)) {")
+rvc_groups.keys.sort.each {|group|
+  inst_decoder_c_fp.printf("    case 0x%02x :\n", group)
+  rvc_groups[group].each {|rvc_info|
+    bits   = rvc_info[RVC::PATTERN]
+    mask   = bits.gsub(/[01]/, '1').gsub(/X/, '0').to_i(2)
+    match  = bits.gsub(/X/, '0').to_i(2)
+    if rvc_info[RVC::EXPAND].nil? then
+      inst_decoder_c_fp.printf("        if ((inst_hex & 0x%04x) == 0x%04x) {  // %s\n", mask, match, rvc_info[RVC::NAME])
+      inst_decoder_c_fp.puts("            return 0;")
+      inst_decoder_c_fp.puts("        }")
+      next
+    end
+    target = $arch_table.find {|inst_info| inst_info[ARCH::NAME].split(" ")[0] == rvc_info[RVC::EXPAND] }
+    if target.nil? then
+      printf("ERROR: %s is expanded into unknown instruction %s\n", rvc_info[RVC::NAME], rvc_info[RVC::EXPAND])
+      next
+    end
+    format = $format_table[target[ARCH::OP]]
+    base   = target[ARCH::R3..ARCH::OP].join.gsub(/X/, '0').to_i(2)
+
+    indent = "            "
+    if mask == 0xe003 then
+      # funct3 and quadrant are tested by switch
+      inst_decoder_c_fp.printf("        {  // %s\n", rvc_info[RVC::NAME])
+    elsif mask == 0xffff then
+      inst_decoder_c_fp.printf("        if (inst_hex == 0x%04x) {  // %s\n", match, rvc_info[RVC::NAME])
+    else
+      inst_decoder_c_fp.printf("        if ((inst_hex & 0x%04x) == 0x%04x) {  // %s\n", mask, match, rvc_info[RVC::NAME])
+    end
+
+    fields = Array["0x%08x"%([base])]
+    rvc_info[RVC::OPERAND].each {|name, field|
+      if rvc_reg_shift.key?(name) then
+        next if field == 0
+        fields.push("(%s << %d)"%([rvc_reg_field(field), rvc_reg_shift[name]]))
+      else
+        top = field.map {|msb, lsb, pos| pos + msb - lsb }.max
+        slices = field.map {|msb, lsb, pos|
+          if lsb == pos then
+            "(inst_hex & 0x%05x)"%([((1 << (msb - lsb + 1)) - 1) << lsb])
+          elsif lsb > pos then
+            "((inst_hex >> %d) & 0x%05x)"%([lsb - pos, ((1 << (msb - lsb + 1)) - 1) << pos])
+          else
+            "((inst_hex << %d) & 0x%05x)"%([pos - lsb, ((1 << (msb - lsb + 1)) - 1) << pos])
+          end
+        }
+        inst_decoder_c_fp.printf("%simm = %s;\n", indent, slices.join(" |\n%s      "%([indent])))
+        if name =~ /^nz/ then
+          inst_decoder_c_fp.printf("%sif (imm == 0) {\n%s    return 0;\n%s}\n", indent, indent, indent)
+        end
+        if name !~ /uimm$/ then
+          inst_decoder_c_fp.printf("%simm = (uint32_t)((int32_t)(imm << %d) >> %d);\n", indent, 31 - top, 31 - top)
+        end
+        fields.push(rvc_imm_encode[format])
+      end
+    }
+    inst_decoder_c_fp.printf("%sreturn %s;\n", indent, fields.join(" |\n%s       "%([indent])))
+    inst_decoder_c_fp.puts("        }")
+  }
+  last_bits = rvc_groups[group][-1][RVC::PATTERN]
+  inst_decoder_c_fp.puts("        return 0;") if last_bits.gsub(/[01]/, '1').gsub(/X/, '0').to_i(2) != 0xe003
+}
+inst_decoder_c_fp.puts("    default :")
+inst_decoder_c_fp.puts("        return 0;")
+inst_decoder_c_fp.puts("    }")
+inst_decoder_c_fp.puts("}")
+
+
+##
+##=== generate reference bit pattern table ===
+##
+## every fixed bit of $arch_table, used by dec_verify to check RISCV_DEC
+##
+inst_pattern_c_fp = File.open('inst_pattern.c', 'w')
+inst_pattern_h_fp = File.open('inst_pattern.h', 'w')
+
+gen_header(inst_pattern_c_fp) # making header
+gen_header(inst_pattern_h_fp) # making header
+
+inst_pattern_h_fp.puts("#pragma once")
+inst_pattern_h_fp.puts("")
+inst_pattern_h_fp.puts("#include <stdint.h>")
+inst_pattern_h_fp.puts("#include \"./inst_list.h\"\n\n\n")
+inst_pattern_h_fp.puts("typedef struct {")
+inst_pattern_h_fp.puts("    uint32_t    mask;    // fixed bits of the encoding")
+inst_pattern_h_fp.puts("    uint32_t    match;   // value of the fixed bits")
+inst_pattern_h_fp.puts("    const char *name;")
+inst_pattern_h_fp.puts("} instPattern;\n\n")
+inst_pattern_h_fp.printf("#define INST_PATTERN_NUM (%d)\n\n", $arch_table.size)
+inst_pattern_h_fp.puts("extern const instPattern inst_pattern[INST_PATTERN_NUM];")
+
+inst_pattern_c_fp.puts("#include <stdint.h>")
+inst_pattern_c_fp.puts("#include \"./inst_pattern.h\"\n\n")
+inst_pattern_c_fp.puts("const instPattern inst_pattern[INST_PATTERN_NUM] = {")
+$arch_table.each {|inst_info|
+  bits = inst_info[ARCH::R3..ARCH::OP].join
+  mask  = bits.gsub(/[01]/, '1').gsub(/X/, '0').to_i(2)
+  match = bits.gsub(/X/, '0').to_i(2)
+  inst_pattern_c_fp.printf("    { 0x%08x, 0x%08x, \"%s\" },  // %s\n", mask, match,
+                           inst_info[ARCH::NAME].split(" ")[0], inst_info[DEC::INST_NAME])
+}
+inst_pattern_c_fp.puts("};")
+
+inst_pattern_c_fp.close()
+inst_pattern_h_fp.close()
+
+
+##
+##=== generate operand formats ===
+##
+## register fields are [name, msb, lsb]. immediate is a list of
+## [msb, lsb, position] slices, sign extended from its highest bit.
+##
+operand_format_array = Array[
+  ['R',  Array[['rd', 11, 7], ['rs1', 19, 15], ['rs2', 24, 20]], nil],
+  ['R4', Array[['rd', 11, 7], ['rs1', 19, 15], ['rs2', 24, 20], ['rs3', 31, 27]], nil],
+  ['I',  Array[['rd', 11, 7], ['rs1', 19, 15]], Array[[31, 20, 0]]],
+  ['S',  Array[['rs1', 19, 15], ['rs2', 24, 20]], Array[[31, 25, 5], [11, 7, 0]]],
+  ['SB', Array[['rs1', 19, 15], ['rs2', 24, 20]], Array[[31, 31, 12], [7, 7, 11], [30, 25, 5], [11, 8, 1]]],
+  ['U',  Array[['rd', 11, 7]], Array[[31, 12, 12]]],
+  ['UJ', Array[['rd', 11, 7]], Array[[31, 31, 20], [19, 12, 12], [20, 20, 11], [30, 21, 1]]],
+]
+
+inst_format_fp = File.open('inst_format.h', 'w')
+gen_header(inst_format_fp) # making header
+
+inst_format_fp.puts("#pragma once")
+inst_format_fp.puts("")
+inst_format_fp.puts("#include <stdint.h>")
+inst_format_fp.puts("#include \"./basic.h\"")
+inst_format_fp.puts("#include \"./inst_list.h\"\n\n\n")
+
+operand_format_array.each {|format, regs, imm|
+  inst_format_fp.puts("typedef struct {")
+  regs.each {|name, msb, lsb|
+    inst_format_fp.printf("    RegAddr_t %s;\n", name)
+  }
+  inst_format_fp.puts("    Word_t    imm;") if imm != nil
+  inst_format_fp.printf("} instOperand%s;\n\n", format)
+}
+
+inst_format_fp.puts("/*!")
+inst_format_fp.puts(" * operands of an instruction, extracted once at decode time.")
+inst_format_fp.puts(" * member is selected by the format of the major opcode.")
+inst_format_fp.puts(" */")
+inst_format_fp.puts("typedef union {")
+operand_format_array.each {|format, regs, imm|
+  inst_format_fp.printf("    %-14s %s;\n", "instOperand%s"%([format]), format.downcase)
+}
+inst_format_fp.puts("} instOperands;\n\n")
+
+inst_format_fp.puts("/*!")
+inst_format_fp.puts(" * format of operands, instOperandNone if instruction has no member")
+inst_format_fp.puts(" */")
+inst_format_fp.puts("typedef enum {")
+inst_format_fp.puts("    instOperandNone = 0,")
+operand_format_array.each {|format, regs, imm|
+  inst_format_fp.printf("    instOperand%sFormat,\n", format)
+}
+inst_format_fp.puts("} instOperandFormat;\n\n")
+
+operand_format_array.each {|format, regs, imm|
+  inst_format_fp.printf("static inline instOperand%s DecodeOperand%s (uint32_t hex)\n", format, format)
+  inst_format_fp.puts("{")
+  inst_format_fp.printf("    instOperand%s op;\n", format)
+  regs.each {|name, msb, lsb|
+    inst_format_fp.printf("    op.%-3s = (hex >> %2d) & 0x%02x;\n", name, lsb, (1 << (msb - lsb + 1)) - 1)
+  }
+  if imm != nil then
+    top = imm.map {|msb, lsb, pos| pos + msb - lsb }.max
+    slices = imm.map {|msb, lsb, pos|
+      if lsb == pos then
+        "(hex & 0x%08x)"%([((1 << (msb - lsb + 1)) - 1) << lsb])
+      elsif pos == 0 then
+        "((hex >> %2d) & 0x%03x)"%([lsb, (1 << (msb - lsb + 1)) - 1])
+      else
+        "(((hex >> %2d) & 0x%03x) << %2d)"%([lsb, (1 << (msb - lsb + 1)) - 1, pos])
+      end
+    }
+    inst_format_fp.printf("    uint32_t imm = %s;\n", slices.join(" |\n                   "))
+    if top == 31 then
+      inst_format_fp.puts("    op.imm = (Word_t)imm;")
+    else
+      inst_format_fp.printf("    op.imm = (Word_t)(imm << %d) >> %d;\n", 31 - top, 31 - top)
+    end
+  end
+  inst_format_fp.puts("    return op;")
+  inst_format_fp.puts("}\n\n")
+}
+
+inst_format_fp.puts("/*!")
+inst_format_fp.puts(" * extract operands of decoded instruction")
+inst_format_fp.puts(" * \\param inst_idx  result of RISCV_DEC")
+inst_format_fp.puts(" * \\param hex       raw instruction")
+inst_format_fp.puts(" * \\param op        extracted operands")
+inst_format_fp.puts(" * \\return          format of operands, member of op which is filled")
+inst_format_fp.puts(" */")
+inst_format_fp.puts("static inline instOperandFormat DecodeInstOperands (uint32_t inst_idx, uint32_t hex, instOperands *op)")
+inst_format_fp.puts("{")
+inst_format_fp.puts("    switch (inst_idx) {")
+operand_format_array.each {|format, regs, imm|
+  $arch_table.each {|inst_info|
+    if $format_table[inst_info[ARCH::OP]] == format then
+      inst_format_fp.printf("    case %s :\n", inst_info[DEC::INST_NAME])
+    end
+  }
+  inst_format_fp.printf("        op->%s = DecodeOperand%s (hex);\n", format.downcase, format)
+  inst_format_fp.printf("        return instOperand%sFormat;\n", format)
+}
+inst_format_fp.puts("    default :")
+inst_format_fp.puts("        return instOperandNone;")
+inst_format_fp.puts("    }")
+inst_format_fp.puts("}")
+
+inst_format_fp.close()
+
+
+##
+##=== generate function table ===
+##
+
+inst_func_fp = File.open('inst_riscv.h', 'w')
+gen_header(inst_func_fp) # making header
+inst_func_fp.puts("#pragma once")
+inst_func_fp.puts("")
+inst_func_fp.puts("")
+
+inst_func_fp.puts("#include <stdint.h>")
+inst_func_fp.puts("#include \"./env.h\"\n")
+inst_func_fp.puts("#include \"./inst_list.h\"\n")
+inst_func_fp.puts("#include \"./dec_utils.h\"\n")
+inst_func_fp.puts("#include \"./inst_format.h\"\n\n\n")
+
+$arch_table.each {|inst_info|
+  inst_func_fp.printf("void RISCV_%s (const instOperands *op, riscvEnv env);\n", inst_info[DEC::INST_NAME]);
+}
+inst_func_fp.puts("\n")
+$arch_table.each {|inst_info|
+  inst_func_fp.printf("void RISCV_%s_NOTRACE (const instOperands *op, riscvEnv env);\n", inst_info[DEC::INST_NAME]);
+}
+
+# handlers in inst_riscv.c are compiled once more without trace recording
+inst_func_fp.puts("\n\n#ifdef SIM_NOTRACE")
+$arch_table.each {|inst_info|
+  inst_func_fp.printf("#define RISCV_%s RISCV_%s_NOTRACE\n", inst_info[DEC::INST_NAME], inst_info[DEC::INST_NAME]);
+}
+inst_func_fp.puts("#endif  // SIM_NOTRACE")
+
+
+##
+##=== generate function call array ===
+##
+inst_array_fp = File.open('inst_call.c', 'w')
+gen_header(inst_array_fp) # making header
+inst_array_fp.puts("")
+inst_array_fp.puts("")
+
+inst_array_fp.puts("#include <stdint.h>")
+inst_array_fp.puts("#include \"./env.h\"\n")
+inst_array_fp.puts("#include \"./inst_riscv.h\"\n")
+
+inst_array_fp.puts("void (* const inst_exec_func[])(const instOperands *, riscvEnv) = {\n");
+$arch_table.each_with_index {|inst_info, index|
+  inst_array_fp.printf("    RISCV_%s", inst_info[DEC::INST_NAME]);
+  if (index == $arch_table.size-1) then
+    inst_array_fp.puts("\n};");
+  else
+    inst_array_fp.puts(",\n");
+  end
+}
+
+inst_array_fp.puts("\n")
+inst_array_fp.puts("void (* const inst_exec_func_notrace[])(const instOperands *, riscvEnv) = {\n");
+$arch_table.each_with_index {|inst_info, index|
+  inst_array_fp.printf("    RISCV_%s_NOTRACE", inst_info[DEC::INST_NAME]);
+  if (index == $arch_table.size-1) then
+    inst_array_fp.puts("\n};");
+  else
+    inst_array_fp.puts(",\n");
+  end
+}
+
+inst_array_fp.close()
+
+
+##
+##=== generate instruction print table ===
+##
+inst_mnemonic_c_fp = File.open('./inst_mnemonic.c', 'w')
+
+gen_header(inst_mnemonic_c_fp) # making header
+
+inst_mnemonic_c_fp.puts("#include \"./inst_list.h\"")
+inst_mnemonic_c_fp.puts("#include \"./inst_operand.h\"\n\n\n")
+
+inst_mnemonic_c_fp.printf("const char inst_strings[%d][INST_STRING_SIZE] = {\n", $arch_table.size);
+$arch_table.each_with_index {|inst_info, index|
+  inst_string = inst_info[ARCH::NAME].gsub(/\w+\[\d+:\d+\]/, "@")
+  inst_mnemonic_c_fp.printf("    [%s] = \"%s\"", inst_info[DEC::INST_NAME], inst_string)
+  if index != $arch_table.size - 1 then
+    inst_mnemonic_c_fp.puts(",\n")
+  end
+}
+inst_mnemonic_c_fp.puts("};\n");
+
+inst_mnemonic_c_fp.printf("\n\nconst printProgram inst_print_prog[%d] = {\n", $arch_table.size);
+$arch_table.each_with_index {|inst_info, index|
+  text  = ""
+  steps = Array[]
+  pieces = inst_info[ARCH::NAME].split(/\w+\[\d+:\d+\]/, -1)
+  inst_info[ARCH::NAME].scan(/(\w+)\[(\d+):(\d+)\]/).each_with_index {|(type, msb, lsb), op_index|
+    prefix = (type == 'd') ? "r" : "0x"
+    width  = msb.to_i - lsb.to_i + 1
+    text  += pieces[op_index] + prefix
+    steps.push("{ %d, %d, %d, %d, 0x%x }"%([pieces[op_index].size + prefix.size, lsb.to_i, (width + 3) / 4,
+                                           (type == 'd') ? 10 : 16, (1 << width) - 1]))
+  }
+  text += pieces[steps.size]
+  inst_mnemonic_c_fp.printf("    [%s] = { %d, %d, { %s }, \"%s\" }", inst_info[DEC::INST_NAME], steps.size,
+                            pieces[steps.size].size, (steps.size == 0) ? "{ 0 }" : steps.join(", "), text)
+  if index != $arch_table.size - 1 then
+    inst_mnemonic_c_fp.puts(",\n")
+  end
+}
+inst_mnemonic_c_fp.puts("};\n");
+
+inst_mnemonic_c_fp.close()
+
+
+##
+##=== generate operand table ===
+##
+inst_operand_h_fp = File.open('./inst_operand.h', 'w');
+
+gen_header(inst_operand_h_fp)  # making header
+
+inst_operand_h_fp.puts("#pragma once")
+inst_operand_h_fp.puts("")
+inst_operand_h_fp.puts("")
+inst_operand_h_fp.puts("#include <stdint.h>")
+inst_operand_h_fp.puts("#include \"./inst_list.h\"")
+inst_operand_h_fp.puts("#include \"./dec_utils.h\"\n\n\n")
+
+inst_operand_h_fp.puts("typedef enum {");
+operand_type_array.each_with_index {|operand_type, index|
+  inst_operand_h_fp.printf("      %s = %d", operand_type[1], index)
+  if index != operand_type_array.size - 1 then
+    inst_operand_h_fp.puts(", ")
+  end
+}
+inst_operand_h_fp.puts(" } operandType;")
+
+inst_operand_h_fp.puts("")
+
+inst_operand_h_fp.puts("#define MAX_OPERANDS 8\n\n");
+inst_operand_h_fp.puts("typedef struct {\n");
+inst_operand_h_fp.puts("    uint32_t size;\n");
+inst_operand_h_fp.puts("    operandType type_lst[MAX_OPERANDS];\n");
+inst_operand_h_fp.puts("    uint32_t msb_lst[MAX_OPERANDS];\n");
+inst_operand_h_fp.puts("    uint32_t lsb_lst[MAX_OPERANDS];\n");
+inst_operand_h_fp.puts("} operandList;\n\n");
+
+inst_operand_h_fp.printf("extern const operandList inst_operand[%d];\n", $arch_table.size)
+inst_print_text_size = $arch_table.map {|inst_info| inst_info[ARCH::NAME].gsub(/\w+\[\d+:\d+\]/, "0x").size }.max + 1
+inst_operand_h_fp.printf("\n#define INST_PRINT_TEXT_SIZE %d\n\n", inst_print_text_size)
+inst_operand_h_fp.puts("/*!")
+inst_operand_h_fp.puts(" * format program of an instruction for the disassembler.")
+inst_operand_h_fp.puts(" * text is the mnemonic string with operand prefixes (r / 0x) and")
+inst_operand_h_fp.puts(" * without '@'. each step copies text_len characters of text, then")
+inst_operand_h_fp.puts(" * prints (inst_hex >> lsb) & mask with digits characters in base.")
+inst_operand_h_fp.puts(" */")
+inst_operand_h_fp.puts("typedef struct {")
+inst_operand_h_fp.puts("    uint8_t  text_len;")
+inst_operand_h_fp.puts("    uint8_t  lsb;")
+inst_operand_h_fp.puts("    uint8_t  digits;")
+inst_operand_h_fp.puts("    uint8_t  base;")
+inst_operand_h_fp.puts("    uint32_t mask;")
+inst_operand_h_fp.puts("} printStep;\n")
+inst_operand_h_fp.puts("typedef struct {")
+inst_operand_h_fp.puts("    uint8_t    size;       // number of operands")
+inst_operand_h_fp.puts("    uint8_t    tail_len;   // text after the last operand")
+inst_operand_h_fp.puts("    printStep  step[MAX_OPERANDS];")
+inst_operand_h_fp.puts("    char       text[INST_PRINT_TEXT_SIZE];")
+inst_operand_h_fp.puts("} printProgram;\n")
+inst_operand_h_fp.printf("extern const printProgram inst_print_prog[%d];\n", $arch_table.size)
+
+inst_string_size = $arch_table.map {|inst_info| inst_info[ARCH::NAME].gsub(/\w+\[\d+:\d+\]/, "@").size }.max + 1
+inst_operand_h_fp.printf("\n#define INST_STRING_SIZE %d\n", inst_string_size)
+inst_operand_h_fp.printf("extern const char inst_strings[%d][INST_STRING_SIZE];\n", $arch_table.size)
+
+
+
+inst_operand_c_fp = File.open('./inst_operand.c', 'w');
+
+gen_header(inst_operand_c_fp)  # making header
+
+inst_operand_c_fp.puts("#include <stdint.h>")
+inst_operand_c_fp.puts("#include \"./inst_list.h\"")
+inst_operand_c_fp.puts("#include \"./inst_operand.h\"\n\n\n")
+
+inst_operand_c_fp.printf("const operandList inst_operand[%d] = {\n", $arch_table.size)
+
+$arch_table.each_with_index {|inst_info, index|
+  operand = inst_info[ARCH::NAME].scan(/\w+\[\d+:\d+\]/)
+  inst_name = $arch_table[index][DEC::INST_NAME]
+  type_lst = Array[]
+  msb_lst  = Array[]
+  lsb_lst  = Array[]
+  operand.each {|bit_field|
+    field = bit_field.match(/(\w+)\[(\d+):(\d+)\]/)
+    operand_type_array.each {|operand_type|
+      if operand_type[0] == field[1] then
+        type_lst.push(operand_type[1])
+        break
+      end
+    }
+    msb_lst.push(field[2])
+    lsb_lst.push(field[3])
+  }
+  inst_operand_c_fp.printf("    [%s] = { %d, { %s }, { %s }, { %s } }", inst_name, operand.size,
+                           type_lst.join(", "), msb_lst.join(", "), lsb_lst.join(", "))
+  if index != $arch_table.size - 1 then
+    inst_operand_c_fp.puts(",")
+  else
+    inst_operand_c_fp.puts("")
+  end
+}
+
+inst_operand_c_fp.puts("};")
+
+inst_operand_c_fp.close()
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "./hart.h"
+#include "./simulation.h"
+#include "./jit.h"
+
+/*!
+ * create hart group on memory of boot hart
+ * \param boot        boot hart, which becomes hart 0
+ * \param hart_count  number of harts
+ * \return            hart group
+ */
+hartGroup CreateHartGroup (riscvEnv boot, uint32_t hart_count)
+{
+    hartGroup group = (hartGroup) checked_malloc (sizeof (*group));
+    memset (group, 0, sizeof (*group));
+    group->harts      = (riscvEnv *) checked_malloc (sizeof (riscvEnv) * hart_count);
+    group->hart_count = hart_count;
+    group->harts[0]   = boot;
+
+    uint32_t i;
+    for (i = 1; i < hart_count; i++) {
+        riscvEnv env = CreateNewRISCVEnv (boot->dbgfp, boot->memory->type);
+        DestroyMemTable (env->memory);
+        env->memory    = boot->memory;
+        env->hart_id   = i;
+        env->pc        = boot->pc;
+        env->regs[10]  = i;   // a0
+        env->step      = boot->step;
+        env->max_cycle = boot->max_cycle;
+        env->exec_mode = boot->exec_mode;
+        if (boot->jit_cache != NULL) {
+            env->jit_cache = CreateJITCache ();
+        }
+
+        if (boot->load_range_count > 0) {
+            env->load_ranges = (loadRange *) checked_malloc (sizeof (loadRange) * boot->load_range_count);
+            memcpy (env->load_ranges, boot->load_ranges, sizeof (loadRange) * boot->load_range_count);
+            env->load_range_count = boot->load_range_count;
+        }
+        env->symbols      = boot->symbols;
+        env->symbol_count = boot->symbol_count;
+        group->harts[i] = env;
+    }
+    atomic_init (&group->halt, false);
+
+    return group;
+}
+
+
+/*!
+ * release hart group. boot hart and files of harts are left to owner.
+ * \param group  hart group
+ */
+void DestroyHartGroup (hartGroup group)
+{
+    uint32_t i;
+    for (i = 1; i < group->hart_count; i++) {
+        group->harts[i]->memory = NULL;   // owned by boot hart
+        DestroyRISCVEnv (group->harts[i]);
+    }
+    free (group->harts);
+    free (group);
+}
+
+
+/*!
+ * stop all harts, only the first request is recorded
+ */
+static void HaltHartGroup (hartGroup group, stopReason reason, uint32_t hart_id)
+{
+    if (atomic_exchange (&group->halt, true) == false) {
+        group->reason       = reason;
+        group->stopped_hart = hart_id;
+    }
+}
+
+
+/*!
+ * run one slice of hart
+ * \param ctx    hart
+ * \param steps  maximum steps of slice
+ * \return false if hart has finished its budget or group is stopped
+ */
+static bool RunHartSlice (hartContext *ctx, UDWord_t steps)
+{
+    hartGroup group = ctx->group;
+    riscvEnv  env   = ctx->env;
+
+    if (group->stop->max_steps != 0) {
+        UDWord_t executed = env->step - ctx->start;
+        if (executed >= group->stop->max_steps) {
+            return false;
+        }
+        if (group->stop->max_steps - executed < steps) {
+            steps = group->stop->max_steps - executed;
+        }
+    }
+    // RunSimulation does not stop before the first instruction
+    if (ctx->first == false && IsBreakpoint (env->pc, env)) {
+        env->stop_reason = stopBreakpoint;
+        HaltHartGroup (group, stopBreakpoint, env->hart_id);
+        return false;
+    }
+    ctx->first = false;
+
+    if (group->deterministic == true && group->current != env->hart_id) {
+        if (env->exec_mode == execModeLog) {
+            fprintf (env->dbgfp, "<Hart %u>\n", env->hart_id);
+        }
+        group->current = env->hart_id;
+    }
+
+    ctx->slice.max_steps = steps;
+    stopReason reason = RunSimulation (env, &ctx->slice);
+    if (reason != stopBudget) {
+        HaltHartGroup (group, reason, env->hart_id);
+        return false;
+    }
+    if (group->deadline != 0.0 && GetTime () >= group->deadline) {
+        env->stop_reason = stopTimeLimit;
+        HaltHartGroup (group, stopTimeLimit, env->hart_id);
+        return false;
+    }
+    return true;
+}
+
+
+/*!
+ * thread of hart, runs slices until budget is exhausted or group is stopped
+ */
+static void *HartMain (void *arg)
+{
+    hartContext *ctx = (hartContext *) arg;
+    while (atomic_load (&ctx->group->halt) == false &&
+           RunHartSlice (ctx, HART_SLICE_STEPS) == true) {
+    }
+    return NULL;
+}
+
+
+/*!
+ * run harts of group
+ * budget of stop conditions is given to each hart. group stops when all
+ * harts finish their budget, or any hart stops by other condition.
+ * \param group          hart group
+ * \param stop           stop conditions
+ * \param deterministic  run harts by turns on calling thread
+ * \param quantum        steps of each turn in deterministic mode
+ * \return reason of the first stop, stopBudget if all harts finished their budget
+ */
+stopReason RunHartGroup (hartGroup group, const stopConditions *stop, bool deterministic, uint32_t quantum)
+{
+    group->stop          = stop;
+    group->deadline      = (stop->time_limit > 0.0) ? GetTime () + stop->time_limit : 0.0;
+    group->deterministic = deterministic;
+    group->current       = UINT32_MAX;
+    group->reason        = stopBudget;
+    group->stopped_hart  = 0;
+    atomic_store (&group->halt, false);
+
+    hartContext *ctx = (hartContext *) checked_malloc (sizeof (hartContext) * group->hart_count);
+    uint32_t i;
+    for (i = 0; i < group->hart_count; i++) {
+        ctx[i].group   = group;
+        ctx[i].env     = group->harts[i];
+        ctx[i].slice   = *stop;
+        ctx[i].slice.time_limit = 0.0;   // deadline is checked for whole group
+        ctx[i].start   = ctx[i].env->step;
+        ctx[i].first   = true;
+        ctx[i].running = true;
+    }
+
+    if (deterministic == true) {
+        uint32_t running = group->hart_count;
+        while (running > 0 && atomic_load (&group->halt) == false) {
+            for (i = 0; i < group->hart_count && atomic_load (&group->halt) == false; i++) {
+                if (ctx[i].running == true && RunHartSlice (&ctx[i], quantum) == false) {
+                    ctx[i].running = false;
+                    running--;
+                }
+            }
+        }
+    } else {
+        for (i = 0; i < group->hart_count; i++) {
+            if (pthread_create (&ctx[i].thread, NULL, HartMain, &ctx[i]) != 0) {
+                perror ("pthread_create");
+                exit (EXIT_FAILURE);
+            }
+        }
+        for (i = 0; i < group->hart_count; i++) {
+            pthread_join (ctx[i].thread, NULL);
+        }
+    }
+
+    // slices are released, harts keep conditions of caller like RunSimulation
+    for (i = 0; i < group->hart_count; i++) {
+        group->harts[i]->stop = stop;
+    }
+    free (ctx);
+    return group->reason;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <stdatomic.h>
+#include <pthread.h>
+#include "./env.h"
+
+/*!
+ * Hart group
+ * harts of one SMP system. each hart is riscvEnv with its own registers,
+ * PC, trace and caches, and all of them share memory table of boot hart.
+ * other harts start from PC of boot hart with hart ID in a0, since mhartid
+ * is not available without CSRs.
+ *
+ * harts run on host threads by slices of HART_SLICE_STEPS, and whole group
+ * stops when any hart stops by other than its budget. in deterministic mode
+ * harts take turns by quantum on the calling thread, so memory accesses of
+ * harts interleave in the same order on every run.
+ */
+#define HART_MAX              16
+#define HART_QUANTUM_DEFAULT  1000
+#define HART_SLICE_STEPS      (1 << 16)
+
+typedef struct __hartGroup *hartGroup;
+
+/*!
+ * state of hart during RunHartGroup
+ */
+typedef struct {
+    hartGroup       group;
+    riscvEnv        env;
+    stopConditions  slice;     // conditions of one slice, same object for every slice
+    UDWord_t        start;     // step at the beginning of RunHartGroup
+    bool            first;     // no slice has been run yet
+    bool            running;   // budget is not exhausted yet
+    pthread_t       thread;
+} hartContext;
+
+struct __hartGroup {
+    riscvEnv   *harts;           // harts[0] is boot hart
+    uint32_t    hart_count;
+    const stopConditions *stop;  // conditions given to RunHartGroup
+    double      deadline;        // wall-clock deadline, 0 is unlimited
+    bool        deterministic;
+    uint32_t    current;         // hart of last slice in deterministic mode
+
+    atomic_bool halt;            // set by the first hart which stops
+    stopReason  reason;          // reason of the first stop
+    uint32_t    stopped_hart;    // hart which stopped first
+};
+
+
+hartGroup  CreateHartGroup (riscvEnv, uint32_t);
+void       DestroyHartGroup (hartGroup);
+stopReason RunHartGroup (hartGroup, const stopConditions *, bool, uint32_t);
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "./env.h"
+#include "./dec_cache.h"
+#include "./image_cache.h"
+
+#define ALIGN_PAGE(x)  (((x) + MEM_PAGE_SIZE - 1) & ~(UDWord_t)MEM_PAGE_MASK)
+
+
+/*!
+ * hash whole source file, 8 bytes per round
+ * \param fp      source file, file position is not used
+ * \param source  size and hash of file
+ * \return        false if file is not a regular file
+ */
+bool HashImageSource (FILE *fp, imageSource *source)
+{
+    struct stat st;
+    if (fstat (fileno (fp), &st) != 0 || S_ISREG (st.st_mode) == false) {
+        return false;
+    }
+    source->size = st.st_size;
+    source->hash = 0xcbf29ce484222325ULL ^ st.st_size;
+    if (st.st_size == 0) {
+        return true;
+    }
+
+    const Byte_t *image = (const Byte_t *) mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno (fp), 0);
+    if (image == MAP_FAILED) {
+        return false;
+    }
+    madvise ((void *)image, st.st_size, MADV_SEQUENTIAL);
+
+    UDWord_t h = source->hash;
+    size_t   i;
+    for (i = 0; i + 8 <= (size_t)st.st_size; i += 8) {
+        UDWord_t w;
+        memcpy (&w, image + i, sizeof (w));
+        h = (h ^ w) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+    for (; i < (size_t)st.st_size; i++) {
+        h = (h ^ image[i]) * 0x100000001b3ULL;
+    }
+    source->hash = h;
+    munmap ((void *)image, st.st_size);
+    return true;
+}
+
+
+/*!
+ * check that table of n entries at offset is inside of file
+ */
+static bool IsInFile (UDWord_t offset, UDWord_t n, size_t entry_size, size_t file_size)
+{
+    return offset <= file_size && n <= (file_size - offset) / entry_size;
+}
+
+
+/*!
+ * load program image from cache file
+ * \param filename  image cache file
+ * \param source    size and hash of current source file
+ * \param env       environment to be load
+ * \return          false if cache is missing, stale or broken
+ */
+bool LoadImageCache (const char *filename, const imageSource *source, riscvEnv env)
+{
+    FILE *fp = fopen (filename, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+    int fd = fileno (fp);
+    struct stat st;
+    if (fstat (fd, &st) != 0 || (size_t)st.st_size < sizeof (imageCacheHeader)) {
+        fclose (fp);
+        return false;
+    }
+    size_t size = st.st_size;
+    const Byte_t *image = (const Byte_t *) mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (image == MAP_FAILED) {
+        fclose (fp);
+        return false;
+    }
+
+    bool result = false;
+    const imageCacheHeader *header = (const imageCacheHeader *)image;
+    if (memcmp (header->magic, IMAGE_CACHE_MAGIC, sizeof (header->magic)) != 0 ||
+        header->version != IMAGE_CACHE_VERSION) {
+        fprintf (stderr, "<Image cache : %s is not an image cache of this version>\n", filename);
+        goto end;
+    }
+    if (header->source.size != source->size || header->source.hash != source->hash) {
+        goto end;   // stale
+    }
+    if (!IsInFile (header->pages_offset,   header->page_count,   sizeof (Addr_t),      size) ||
+        !IsInFile (header->ranges_offset,  header->range_count,  sizeof (loadRange),   size) ||
+        !IsInFile (header->symbols_offset, header->symbol_count, sizeof (imageSymbol), size) ||
+        !IsInFile (header->names_offset,   header->names_size,   1,                    size) ||
+        !IsInFile (header->insts_offset,   header->inst_count,   sizeof (imageInst),   size) ||
+        !IsInFile (header->data_offset,    header->page_count,   MEM_PAGE_SIZE,        size) ||
+        (header->data_offset & MEM_PAGE_MASK) != 0 ||
+        (header->names_size > 0 && image[header->names_offset + header->names_size - 1] != '\0')) {
+        fprintf (stderr, "<Image cache : %s is broken>\n", filename);
+        goto end;
+    }
+    const imageSymbol *symbols = (const imageSymbol *)(image + header->symbols_offset);
+    for (uint32_t i = 0; i < header->symbol_count; i++) {
+        if (symbols[i].name >= header->names_size) {
+            fprintf (stderr, "<Image cache : %s is broken>\n", filename);
+            goto end;
+        }
+    }
+    // pages are mapped at their address, so they must be page heads
+    const Addr_t *pages = (const Addr_t *)(image + header->pages_offset);
+    for (uint32_t i = 0; i < header->page_count; i++) {
+        if ((pages[i] & MEM_PAGE_MASK) != 0) {
+            fprintf (stderr, "<Image cache : %s is broken>\n", filename);
+            goto end;
+        }
+    }
+
+    // memory image, mapped from cache if guest memory is mmap backend
+    bool map_pages = (env->memory->type == memTypeMmap && sysconf (_SC_PAGESIZE) == MEM_PAGE_SIZE);
+    for (uint32_t i = 0; i < header->page_count; ) {
+        uint32_t n = 1;   // pages continuous in guest and in file, not wrapping around 4GB
+        while (i + n < header->page_count &&
+               (UDWord_t)pages[i + n] == (UDWord_t)pages[i] + (UDWord_t)n * MEM_PAGE_SIZE) {
+            n++;
+        }
+        UDWord_t offset = header->data_offset + (UDWord_t)i * MEM_PAGE_SIZE;
+        if (map_pages == false ||
+            mmap (env->memory->base + pages[i], (size_t)n * MEM_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_FIXED, fd, offset) == MAP_FAILED) {
+            for (uint32_t p = 0; p < n; p++) {
+                WriteMemoryImage (pages[i + p], image + offset + (UDWord_t)p * MEM_PAGE_SIZE, MEM_PAGE_SIZE, env);
+            }
+        }
+        i += n;
+    }
+
+    const loadRange *ranges = (const loadRange *)(image + header->ranges_offset);
+    for (uint32_t i = 0; i < header->range_count; i++) {
+        AddLoadRange (ranges[i].start, ranges[i].size, env);
+    }
+
+    if (header->symbol_count > 0) {
+        char *names = (char *) checked_malloc (header->names_size);
+        memcpy (names, image + header->names_offset, header->names_size);
+        env->symbols = (guestSymbol *) checked_malloc (sizeof (guestSymbol) * header->symbol_count);
+        for (uint32_t i = 0; i < header->symbol_count; i++) {
+            env->symbols[i].addr = symbols[i].addr;
+            env->symbols[i].size = symbols[i].size;
+            env->symbols[i].name = names + symbols[i].name;
+        }
+        env->symbol_count = header->symbol_count;
+        env->symbol_names = names;
+    }
+
+    // instructions are decoded by this simulator, while they match the image
+    const imageInst *insts = (const imageInst *)(image + header->insts_offset);
+    for (uint32_t i = 0; i < header->inst_count; i++) {
+        Addr_t pc = insts[i].pc;
+        if ((pc & 0x01) != 0) {
+            break;
+        }
+        Word_t hex = LoadMemoryNoTrace (pc, Size_HWord, env) & 0xffff;
+        if ((hex & 0x03) == 0x03) {
+            hex |= LoadMemoryNoTrace (pc + 2, Size_HWord, env) << 16;
+        }
+        if (hex != insts[i].inst_hex) {
+            break;
+        }
+        PreloadDecCache (pc, hex, env);
+    }
+
+    env->pc = header->entry;
+    result = true;
+
+end:
+    munmap ((void *)image, size);
+    fclose (fp);
+    return result;
+}
+
+
+/*!
+ * write loaded program image into cache file
+ * file is written with temporary name and renamed, so that runs in
+ * parallel never see partial file.
+ * \param filename  image cache file
+ * \param source    size and hash of source file
+ * \param env       environment which has just loaded source
+ * \return          false if file cannot be written
+ */
+bool SaveImageCache (const char *filename, const imageSource *source, riscvEnv env)
+{
+    uint32_t page_count;
+    Addr_t  *pages = ListTouchedPages (env, &page_count);
+
+    // instructions from entry point, in the range which has it
+    uint32_t   inst_count = 0;
+    imageInst *insts = (imageInst *) checked_malloc (sizeof (imageInst) * DEC_CACHE_SIZE);
+    for (uint32_t r = 0; r < env->load_range_count; r++) {
+        const loadRange *range = &env->load_ranges[r];
+        if (env->pc - range->start >= range->size) {
+            continue;
+        }
+        Addr_t tail = range->start + range->size;
+        for (Addr_t pc = env->pc & ~1; inst_count < DEC_CACHE_SIZE && pc + 2 <= tail && pc >= range->start; ) {
+            Word_t hex = LoadMemoryNoTrace (pc, Size_HWord, env);
+            if ((hex & 0x03) == 0x03) {
+                if (pc + 4 > tail) {
+                    break;
+                }
+                hex |= LoadMemoryNoTrace (pc + 2, Size_HWord, env) << 16;
+            }
+            insts[inst_count].pc       = pc;
+            insts[inst_count].inst_hex = hex;
+            pc += ((hex & 0x03) == 0x03) ? 4 : 2;
+            inst_count++;
+        }
+        break;
+    }
+
+    // symbol names
+    uint32_t names_size = 0;
+    for (uint32_t i = 0; i < env->symbol_count; i++) {
+        names_size += strlen (env->symbols[i].name) + 1;
+    }
+
+    imageCacheHeader header;
+    memset (&header, 0, sizeof (header));
+    memcpy (header.magic, IMAGE_CACHE_MAGIC, sizeof (header.magic));
+    header.version        = IMAGE_CACHE_VERSION;
+    header.source         = *source;
+    header.entry          = env->pc;
+    header.page_count     = page_count;
+    header.range_count    = env->load_range_count;
+    header.symbol_count   = env->symbol_count;
+    header.names_size     = names_size;
+    header.inst_count     = inst_count;
+    header.pages_offset   = MEM_PAGE_SIZE;
+    header.ranges_offset  = header.pages_offset   + sizeof (Addr_t) * page_count;
+    header.symbols_offset = header.ranges_offset  + sizeof (loadRange) * env->load_range_count;
+    header.names_offset   = header.symbols_offset + sizeof (imageSymbol) * env->symbol_count;
+    header.insts_offset   = (header.names_offset  + names_size + 7) & ~7ULL;
+    header.data_offset    = ALIGN_PAGE (header.insts_offset + sizeof (imageInst) * inst_count);
+
+    size_t name_len = strlen (filename) + 32;
+    char  *temp_name = (char *) checked_malloc (name_len);
+    snprintf (temp_name, name_len, "%s.tmp.%d", filename, (int)getpid ());
+    FILE *fp = fopen (temp_name, "wb");
+    if (fp == NULL) {
+        perror ("fopen");
+        free (temp_name);
+        free (insts);
+        free (pages);
+        return false;
+    }
+    setvbuf (fp, NULL, _IOFBF, 1 << 20);
+
+    static const Byte_t zero[MEM_PAGE_SIZE];
+    fwrite (&header, sizeof (header), 1, fp);
+    fwrite (zero, 1, header.pages_offset - sizeof (header), fp);
+    fwrite (pages, sizeof (Addr_t), page_count, fp);
+    fwrite (env->load_ranges, sizeof (loadRange), env->load_range_count, fp);
+    uint32_t name_offset = 0;
+    for (uint32_t i = 0; i < env->symbol_count; i++) {
+        imageSymbol sym = {env->symbols[i].addr, env->symbols[i].size, name_offset};
+        fwrite (&sym, sizeof (sym), 1, fp);
+        name_offset += strlen (env->symbols[i].name) + 1;
+    }
+    for (uint32_t i = 0; i < env->symbol_count; i++) {
+        fwrite (env->symbols[i].name, 1, strlen (env->symbols[i].name) + 1, fp);
+    }
+    fwrite (zero, 1, header.insts_offset - (header.names_offset + names_size), fp);
+    fwrite (insts, sizeof (imageInst), inst_count, fp);
+    fwrite (zero, 1, header.data_offset - (header.insts_offset + sizeof (imageInst) * inst_count), fp);
+    for (uint32_t i = 0; i < page_count; i++) {
+        const Byte_t *page = GetMemPage (env->memory, pages[i], false);
+        fwrite (page != NULL ? page : zero, 1, MEM_PAGE_SIZE, fp);
+    }
+
+    bool result = (ferror (fp) == 0);
+    if (fclose (fp) != 0 || result == false || rename (temp_name, filename) != 0) {
+        fprintf (stderr, "<Image cache : failed to write %s>\n", filename);
+        unlink (temp_name);
+        result = false;
+    }
+    free (temp_name);
+    free (insts);
+    free (pages);
+    return result;
+}
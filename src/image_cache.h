@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#pragma once
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "./env.h"
+
+/*!
+ * Image cache file
+ * loaded program image kept in binary form, to skip parsing of source
+ * (s-record or ELF) in later runs. it is used only while size and hash of
+ * source file are same.
+ *
+ *   header       : imageCacheHeader, padded to a page
+ *   tables       : page addresses, load ranges, symbols, symbol names and
+ *                  pre-decoded instructions, at offsets given by header
+ *   page data    : MEM_PAGE_SIZE per page, page-aligned so that it can be
+ *                  mapped into guest memory directly
+ *
+ * instructions cover the head of code from entry point, as much as decode
+ * cache holds. only address and word are kept, they are decoded again by
+ * loader, so that file never gives decoded fields to simulator.
+ * values are stored in host byte order.
+ */
+#define IMAGE_CACHE_MAGIC    "SWIMAGE"
+#define IMAGE_CACHE_VERSION  3
+
+typedef struct {
+    UDWord_t size;
+    UDWord_t hash;
+} imageSource;
+
+typedef struct {
+    char        magic[8];
+    uint32_t    version;
+    imageSource source;
+    Addr_t      entry;           // initial PC
+    uint32_t    page_count;
+    uint32_t    range_count;
+    uint32_t    symbol_count;
+    uint32_t    names_size;
+    uint32_t    inst_count;
+    UDWord_t    pages_offset;    // Addr_t [page_count]
+    UDWord_t    ranges_offset;   // loadRange [range_count]
+    UDWord_t    symbols_offset;  // imageSymbol [symbol_count]
+    UDWord_t    names_offset;    // NUL terminated names
+    UDWord_t    insts_offset;    // imageInst [inst_count]
+    UDWord_t    data_offset;     // page data, page-aligned
+} imageCacheHeader;
+
+typedef struct {
+    Addr_t   addr;
+    uint32_t size;
+    uint32_t name;   // offset in names
+} imageSymbol;
+
+typedef struct {
+    Addr_t pc;
+    Word_t inst_hex;   // upper half is 0 if compressed
+} imageInst;
+
+bool HashImageSource (FILE *fp, imageSource *source);
+bool LoadImageCache (const char *filename, const imageSource *source, riscvEnv env);
+bool SaveImageCache (const char *filename, const imageSource *source, riscvEnv env);
@@ -0,0 +1,1171 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#include <stdint.h>
+#include "./inst_list.h"
+#include "./inst_decoder.h"
+
+
+#define DEC_ILLEGAL   (0xffff)
+#define DEC_NODE_FLAG (0x8000)
+#define DEC_NODE(n)   (DEC_NODE_FLAG | (n))
+#define DEC_MAX_DEPTH (6)
+
+typedef struct {
+    uint8_t  shift;
+    uint8_t  mask;
+    uint16_t base;   // first entry in dec_entries[]
+} decNode;
+
+static const decNode dec_nodes[] = {
+    {  0, 0x7f,     0 },  //   0 : RISCV_DEC_OP
+    { 12, 0x07,   128 },  //   1 : RISCV_DEC_OP_0x67_F3
+    { 12, 0x07,   136 },  //   2 : RISCV_DEC_OP_0x63_F3
+    { 12, 0x07,   144 },  //   3 : RISCV_DEC_OP_0x3_F3
+    { 12, 0x07,   152 },  //   4 : RISCV_DEC_OP_0x23_F3
+    { 12, 0x07,   160 },  //   5 : RISCV_DEC_OP_0x13_F3
+    { 25, 0x03,   168 },  //   6 : RISCV_DEC_OP_0x13_F3_0x1_F2
+    { 27, 0x1f,   172 },  //   7 : RISCV_DEC_OP_0x13_F3_0x1_F2_0x0_R3
+    { 25, 0x03,   204 },  //   8 : RISCV_DEC_OP_0x13_F3_0x5_F2
+    { 27, 0x1f,   208 },  //   9 : RISCV_DEC_OP_0x13_F3_0x5_F2_0x0_R3
+    { 12, 0x07,   240 },  //  10 : RISCV_DEC_OP_0x33_F3
+    { 25, 0x03,   248 },  //  11 : RISCV_DEC_OP_0x33_F3_0x0_F2
+    { 27, 0x1f,   252 },  //  12 : RISCV_DEC_OP_0x33_F3_0x0_F2_0x0_R3
+    { 27, 0x1f,   284 },  //  13 : RISCV_DEC_OP_0x33_F3_0x0_F2_0x1_R3
+    { 25, 0x03,   316 },  //  14 : RISCV_DEC_OP_0x33_F3_0x1_F2
+    { 27, 0x1f,   320 },  //  15 : RISCV_DEC_OP_0x33_F3_0x1_F2_0x0_R3
+    { 27, 0x1f,   352 },  //  16 : RISCV_DEC_OP_0x33_F3_0x1_F2_0x1_R3
+    { 25, 0x03,   384 },  //  17 : RISCV_DEC_OP_0x33_F3_0x2_F2
+    { 27, 0x1f,   388 },  //  18 : RISCV_DEC_OP_0x33_F3_0x2_F2_0x0_R3
+    { 27, 0x1f,   420 },  //  19 : RISCV_DEC_OP_0x33_F3_0x2_F2_0x1_R3
+    { 25, 0x03,   452 },  //  20 : RISCV_DEC_OP_0x33_F3_0x3_F2
+    { 27, 0x1f,   456 },  //  21 : RISCV_DEC_OP_0x33_F3_0x3_F2_0x0_R3
+    { 27, 0x1f,   488 },  //  22 : RISCV_DEC_OP_0x33_F3_0x3_F2_0x1_R3
+    { 25, 0x03,   520 },  //  23 : RISCV_DEC_OP_0x33_F3_0x4_F2
+    { 27, 0x1f,   524 },  //  24 : RISCV_DEC_OP_0x33_F3_0x4_F2_0x0_R3
+    { 27, 0x1f,   556 },  //  25 : RISCV_DEC_OP_0x33_F3_0x4_F2_0x1_R3
+    { 25, 0x03,   588 },  //  26 : RISCV_DEC_OP_0x33_F3_0x5_F2
+    { 27, 0x1f,   592 },  //  27 : RISCV_DEC_OP_0x33_F3_0x5_F2_0x0_R3
+    { 27, 0x1f,   624 },  //  28 : RISCV_DEC_OP_0x33_F3_0x5_F2_0x1_R3
+    { 25, 0x03,   656 },  //  29 : RISCV_DEC_OP_0x33_F3_0x6_F2
+    { 27, 0x1f,   660 },  //  30 : RISCV_DEC_OP_0x33_F3_0x6_F2_0x0_R3
+    { 27, 0x1f,   692 },  //  31 : RISCV_DEC_OP_0x33_F3_0x6_F2_0x1_R3
+    { 25, 0x03,   724 },  //  32 : RISCV_DEC_OP_0x33_F3_0x7_F2
+    { 27, 0x1f,   728 },  //  33 : RISCV_DEC_OP_0x33_F3_0x7_F2_0x0_R3
+    { 27, 0x1f,   760 },  //  34 : RISCV_DEC_OP_0x33_F3_0x7_F2_0x1_R3
+    { 12, 0x07,   792 },  //  35 : RISCV_DEC_OP_0xf_F3
+    { 15, 0x1f,   800 },  //  36 : RISCV_DEC_OP_0xf_F3_0x0_R1
+    { 25, 0x03,   832 },  //  37 : RISCV_DEC_OP_0xf_F3_0x1_F2
+    { 27, 0x1f,   836 },  //  38 : RISCV_DEC_OP_0xf_F3_0x1_F2_0x0_R3
+    { 20, 0x1f,   868 },  //  39 : RISCV_DEC_OP_0xf_F3_0x1_F2_0x0_R3_0x0_R2
+    { 15, 0x1f,   900 },  //  40 : RISCV_DEC_OP_0xf_F3_0x1_F2_0x0_R3_0x0_R2_0x0_R1
+    { 12, 0x07,   932 },  //  41 : RISCV_DEC_OP_0x73_F3
+    { 25, 0x03,   940 },  //  42 : RISCV_DEC_OP_0x73_F3_0x0_F2
+    { 27, 0x1f,   944 },  //  43 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3
+    { 20, 0x1f,   976 },  //  44 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3_0x0_R2
+    { 15, 0x1f,  1008 },  //  45 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3_0x0_R2_0x0_R1
+    { 15, 0x1f,  1040 },  //  46 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3_0x0_R2_0x1_R1
+    { 25, 0x03,  1072 },  //  47 : RISCV_DEC_OP_0x73_F3_0x2_F2
+    { 27, 0x1f,  1076 },  //  48 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3
+    { 20, 0x1f,  1108 },  //  49 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2
+    { 15, 0x1f,  1140 },  //  50 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2_0x0_R1
+    { 15, 0x1f,  1172 },  //  51 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2_0x1_R1
+    { 15, 0x1f,  1204 },  //  52 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2_0x2_R1
+    { 20, 0x1f,  1236 },  //  53 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2
+    { 15, 0x1f,  1268 },  //  54 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2_0x0_R1
+    { 15, 0x1f,  1300 },  //  55 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2_0x1_R1
+    { 15, 0x1f,  1332 },  //  56 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2_0x2_R1
+    { 20, 0x1f,  1364 },  //  57 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2
+    { 15, 0x1f,  1396 },  //  58 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2_0x3_R1
+    { 15, 0x1f,  1428 },  //  59 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2_0x2_R1
+    { 15, 0x1f,  1460 },  //  60 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2_0x1_R1
+    { 25, 0x03,  1492 },  //  61 : RISCV_DEC_OP_0x73_F3_0x1_F2
+    { 27, 0x1f,  1496 },  //  62 : RISCV_DEC_OP_0x73_F3_0x1_F2_0x0_R3
+    { 20, 0x1f,  1528 },  //  63 : RISCV_DEC_OP_0x73_F3_0x1_F2_0x0_R3_0x0_R2
+    { 25, 0x03,  1560 },  //  64 : RISCV_DEC_OP_0x73_F3_0x5_F2
+    { 27, 0x1f,  1564 },  //  65 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3
+    { 20, 0x1f,  1596 },  //  66 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3_0x0_R2
+    { 15, 0x1f,  1628 },  //  67 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3_0x0_R2_0x2_R1
+    { 15, 0x1f,  1660 },  //  68 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3_0x0_R2_0x1_R1
+    { 12, 0x07,  1692 },  //  69 : RISCV_DEC_OP_0x2f_F3
+    { 27, 0x1f,  1700 },  //  70 : RISCV_DEC_OP_0x2f_F3_0x2_R3
+    { 20, 0x1f,  1732 },  //  71 : RISCV_DEC_OP_0x2f_F3_0x2_R3_0x2_R2
+    { 12, 0x07,  1764 },  //  72 : RISCV_DEC_OP_0x7_F3
+    { 12, 0x07,  1772 },  //  73 : RISCV_DEC_OP_0x27_F3
+    { 25, 0x03,  1780 },  //  74 : RISCV_DEC_OP_0x43_F2
+    { 25, 0x03,  1784 },  //  75 : RISCV_DEC_OP_0x47_F2
+    { 25, 0x03,  1788 },  //  76 : RISCV_DEC_OP_0x4b_F2
+    { 25, 0x03,  1792 },  //  77 : RISCV_DEC_OP_0x4f_F2
+    { 25, 0x03,  1796 },  //  78 : RISCV_DEC_OP_0x53_F2
+    { 27, 0x1f,  1800 },  //  79 : RISCV_DEC_OP_0x53_F2_0x0_R3
+    { 20, 0x1f,  1832 },  //  80 : RISCV_DEC_OP_0x53_F2_0x0_R3_0xb_R2
+    { 12, 0x07,  1864 },  //  81 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x4_F3
+    { 12, 0x07,  1872 },  //  82 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x5_F3
+    { 20, 0x1f,  1880 },  //  83 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x18_R2
+    { 20, 0x1f,  1912 },  //  84 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1c_R2
+    { 12, 0x07,  1944 },  //  85 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1c_R2_0x0_F3
+    { 12, 0x07,  1952 },  //  86 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x14_F3
+    { 20, 0x1f,  1960 },  //  87 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1a_R2
+    { 20, 0x1f,  1992 },  //  88 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1e_R2
+    { 12, 0x07,  2024 },  //  89 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1e_R2_0x0_F3
+    { 20, 0x1f,  2032 },  //  90 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x8_R2
+    { 27, 0x1f,  2064 },  //  91 : RISCV_DEC_OP_0x53_F2_0x1_R3
+    { 20, 0x1f,  2096 },  //  92 : RISCV_DEC_OP_0x53_F2_0x1_R3_0xb_R2
+    { 12, 0x07,  2128 },  //  93 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x4_F3
+    { 12, 0x07,  2136 },  //  94 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x5_F3
+    { 20, 0x1f,  2144 },  //  95 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x8_R2
+    { 12, 0x07,  2176 },  //  96 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x14_F3
+    { 20, 0x1f,  2184 },  //  97 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x1c_R2
+    { 12, 0x07,  2216 },  //  98 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x1c_R2_0x0_F3
+    { 20, 0x1f,  2224 },  //  99 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x18_R2
+    { 20, 0x1f,  2256 },  // 100 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x1a_R2
+};
+
+static const uint16_t dec_entries[] = {
+    // 0 : RISCV_DEC_OP
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(3),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(72),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(35),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(5),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , INST_AUIPC,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(4),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(73),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(69),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(10),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , INST_LUI,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(74),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(75),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(76),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(77),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(78),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(2),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(1),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , INST_JAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(41),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 1 : RISCV_DEC_OP_0x67_F3
+    INST_JALR       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 2 : RISCV_DEC_OP_0x63_F3
+    INST_BEQ        , INST_BNE        , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_BLT        , INST_BGE        , INST_BLTU       , INST_BGEU,
+    // 3 : RISCV_DEC_OP_0x3_F3
+    INST_LB         , INST_LH         , INST_LW         , DEC_ILLEGAL,
+    INST_LBU        , INST_LHU        , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 4 : RISCV_DEC_OP_0x23_F3
+    INST_SB         , INST_SH         , INST_SW         , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 5 : RISCV_DEC_OP_0x13_F3
+    INST_ADDI       , DEC_NODE(6)     , INST_SLTI       , INST_SLTIU,
+    INST_XORI       , DEC_NODE(8)     , INST_ORI        , INST_ANDI,
+    // 6 : RISCV_DEC_OP_0x13_F3_0x1_F2
+    DEC_NODE(7)     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 7 : RISCV_DEC_OP_0x13_F3_0x1_F2_0x0_R3
+    INST_SLLI       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 8 : RISCV_DEC_OP_0x13_F3_0x5_F2
+    DEC_NODE(9)     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 9 : RISCV_DEC_OP_0x13_F3_0x5_F2_0x0_R3
+    INST_SRLI       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_SRAI       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 10 : RISCV_DEC_OP_0x33_F3
+    DEC_NODE(11)    , DEC_NODE(14)    , DEC_NODE(17)    , DEC_NODE(20),
+    DEC_NODE(23)    , DEC_NODE(26)    , DEC_NODE(29)    , DEC_NODE(32),
+    // 11 : RISCV_DEC_OP_0x33_F3_0x0_F2
+    DEC_NODE(12)    , DEC_NODE(13)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 12 : RISCV_DEC_OP_0x33_F3_0x0_F2_0x0_R3
+    INST_ADD        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_SUB        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 13 : RISCV_DEC_OP_0x33_F3_0x0_F2_0x1_R3
+    INST_MUL        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 14 : RISCV_DEC_OP_0x33_F3_0x1_F2
+    DEC_NODE(15)    , DEC_NODE(16)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 15 : RISCV_DEC_OP_0x33_F3_0x1_F2_0x0_R3
+    INST_SLL        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 16 : RISCV_DEC_OP_0x33_F3_0x1_F2_0x1_R3
+    INST_MULH       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 17 : RISCV_DEC_OP_0x33_F3_0x2_F2
+    DEC_NODE(18)    , DEC_NODE(19)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 18 : RISCV_DEC_OP_0x33_F3_0x2_F2_0x0_R3
+    INST_SLT        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 19 : RISCV_DEC_OP_0x33_F3_0x2_F2_0x1_R3
+    INST_MULHSU     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 20 : RISCV_DEC_OP_0x33_F3_0x3_F2
+    DEC_NODE(21)    , DEC_NODE(22)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 21 : RISCV_DEC_OP_0x33_F3_0x3_F2_0x0_R3
+    INST_SLTU       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 22 : RISCV_DEC_OP_0x33_F3_0x3_F2_0x1_R3
+    INST_MULHU      , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 23 : RISCV_DEC_OP_0x33_F3_0x4_F2
+    DEC_NODE(24)    , DEC_NODE(25)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 24 : RISCV_DEC_OP_0x33_F3_0x4_F2_0x0_R3
+    INST_XOR        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 25 : RISCV_DEC_OP_0x33_F3_0x4_F2_0x1_R3
+    INST_DIV        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 26 : RISCV_DEC_OP_0x33_F3_0x5_F2
+    DEC_NODE(27)    , DEC_NODE(28)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 27 : RISCV_DEC_OP_0x33_F3_0x5_F2_0x0_R3
+    INST_SRL        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_SRA        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 28 : RISCV_DEC_OP_0x33_F3_0x5_F2_0x1_R3
+    INST_DIVU       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 29 : RISCV_DEC_OP_0x33_F3_0x6_F2
+    DEC_NODE(30)    , DEC_NODE(31)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 30 : RISCV_DEC_OP_0x33_F3_0x6_F2_0x0_R3
+    INST_OR         , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 31 : RISCV_DEC_OP_0x33_F3_0x6_F2_0x1_R3
+    INST_REM        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 32 : RISCV_DEC_OP_0x33_F3_0x7_F2
+    DEC_NODE(33)    , DEC_NODE(34)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 33 : RISCV_DEC_OP_0x33_F3_0x7_F2_0x0_R3
+    INST_AND        , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 34 : RISCV_DEC_OP_0x33_F3_0x7_F2_0x1_R3
+    INST_REMU       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 35 : RISCV_DEC_OP_0xf_F3
+    DEC_NODE(36)    , DEC_NODE(37)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 36 : RISCV_DEC_OP_0xf_F3_0x0_R1
+    INST_FENCE      , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 37 : RISCV_DEC_OP_0xf_F3_0x1_F2
+    DEC_NODE(38)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 38 : RISCV_DEC_OP_0xf_F3_0x1_F2_0x0_R3
+    DEC_NODE(39)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 39 : RISCV_DEC_OP_0xf_F3_0x1_F2_0x0_R3_0x0_R2
+    DEC_NODE(40)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 40 : RISCV_DEC_OP_0xf_F3_0x1_F2_0x0_R3_0x0_R2_0x0_R1
+    INST_FENCE_I    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 41 : RISCV_DEC_OP_0x73_F3
+    DEC_NODE(42)    , DEC_NODE(61)    , DEC_NODE(47)    , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_NODE(64)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 42 : RISCV_DEC_OP_0x73_F3_0x0_F2
+    DEC_NODE(43)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 43 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3
+    DEC_NODE(44)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 44 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3_0x0_R2
+    DEC_NODE(45)    , DEC_NODE(46)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 45 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3_0x0_R2_0x0_R1
+    INST_SCALL      , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 46 : RISCV_DEC_OP_0x73_F3_0x0_F2_0x0_R3_0x0_R2_0x1_R1
+    INST_SBREAK     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 47 : RISCV_DEC_OP_0x73_F3_0x2_F2
+    DEC_NODE(48)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 48 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3
+    DEC_NODE(57)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_NODE(49)    , DEC_NODE(53)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 49 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2
+    DEC_NODE(50)    , DEC_NODE(51)    , DEC_NODE(52)    , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 50 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2_0x0_R1
+    INST_RDCYCLE    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 51 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2_0x1_R1
+    INST_RDTIME     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 52 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x18_R2_0x2_R1
+    INST_RDINSTRET  , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 53 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2
+    DEC_NODE(54)    , DEC_NODE(55)    , DEC_NODE(56)    , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 54 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2_0x0_R1
+    INST_RDCYCLEH   , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 55 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2_0x1_R1
+    INST_RDTIMEH    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 56 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x19_R2_0x2_R1
+    INST_RDINSTRETH , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 57 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2
+    DEC_ILLEGAL     , DEC_NODE(60)    , DEC_NODE(59)    , DEC_NODE(58),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 58 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2_0x3_R1
+    INST_FRCSR      , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 59 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2_0x2_R1
+    INST_FRRM       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 60 : RISCV_DEC_OP_0x73_F3_0x2_F2_0x0_R3_0x0_R2_0x1_R1
+    INST_FRFLAGS    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 61 : RISCV_DEC_OP_0x73_F3_0x1_F2
+    DEC_NODE(62)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 62 : RISCV_DEC_OP_0x73_F3_0x1_F2_0x0_R3
+    DEC_NODE(63)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 63 : RISCV_DEC_OP_0x73_F3_0x1_F2_0x0_R3_0x0_R2
+    DEC_ILLEGAL     , INST_FSFLAGS    , INST_FSRM       , INST_FSCSR,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 64 : RISCV_DEC_OP_0x73_F3_0x5_F2
+    DEC_NODE(65)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 65 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3
+    DEC_NODE(66)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 66 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3_0x0_R2
+    DEC_ILLEGAL     , DEC_NODE(68)    , DEC_NODE(67)    , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 67 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3_0x0_R2_0x2_R1
+    INST_FSRMI      , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 68 : RISCV_DEC_OP_0x73_F3_0x5_F2_0x0_R3_0x0_R2_0x1_R1
+    INST_FSFLAGSI   , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 69 : RISCV_DEC_OP_0x2f_F3
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(70)    , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 70 : RISCV_DEC_OP_0x2f_F3_0x2_R3
+    INST_AMOADD_W   , INST_AMOSWAP_W  , DEC_NODE(71)    , INST_SC_W,
+    INST_AMOXOR_W   , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_AMOOR_W    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_AMOAND_W   , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , INST_AMOMIN_W   , DEC_ILLEGAL,
+    INST_AMOMAX_W   , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_AMOMINU_W  , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    INST_AMOMAXU_W  , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 71 : RISCV_DEC_OP_0x2f_F3_0x2_R3_0x2_R2
+    INST_LR_W       , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 72 : RISCV_DEC_OP_0x7_F3
+    DEC_ILLEGAL     , DEC_ILLEGAL     , INST_FLW        , INST_FLD,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 73 : RISCV_DEC_OP_0x27_F3
+    DEC_ILLEGAL     , DEC_ILLEGAL     , INST_FSW        , INST_FSD,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 74 : RISCV_DEC_OP_0x43_F2
+    INST_FMADD_S    , INST_FMADD_D    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 75 : RISCV_DEC_OP_0x47_F2
+    INST_FMSUB_S    , INST_FMSUB_D    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 76 : RISCV_DEC_OP_0x4b_F2
+    INST_FNMSUB_S   , INST_FNMSUB_D   , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 77 : RISCV_DEC_OP_0x4f_F2
+    INST_FNMADD_S   , INST_FNMADD_D   , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 78 : RISCV_DEC_OP_0x53_F2
+    DEC_NODE(79)    , DEC_NODE(91)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 79 : RISCV_DEC_OP_0x53_F2_0x0_R3
+    INST_FADD_S     , INST_FSUB_S     , INST_FMUL_S     , INST_FDIV_S,
+    DEC_NODE(81)    , DEC_NODE(82)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_NODE(90)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(80),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_NODE(86)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_NODE(83)    , DEC_ILLEGAL     , DEC_NODE(87)    , DEC_ILLEGAL,
+    DEC_NODE(84)    , DEC_ILLEGAL     , DEC_NODE(88)    , DEC_ILLEGAL,
+    // 80 : RISCV_DEC_OP_0x53_F2_0x0_R3_0xb_R2
+    INST_FSQRT_S    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 81 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x4_F3
+    INST_FSGNJ_S    , INST_FSGNJN_S   , INST_FSGNJX_S   , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 82 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x5_F3
+    INST_FMIN_S     , INST_FMAX_S     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 83 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x18_R2
+    INST_FCVT_W_S   , INST_FCVT_WU_S  , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 84 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1c_R2
+    DEC_NODE(85)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 85 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1c_R2_0x0_F3
+    INST_FMV_X_S    , INST_FCLASS_S   , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 86 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x14_F3
+    INST_FLE_S      , INST_FLT_S      , INST_FEQ_S      , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 87 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1a_R2
+    INST_FCVT_S_W   , INST_FCVT_S_WU  , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 88 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1e_R2
+    DEC_NODE(89)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 89 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x1e_R2_0x0_F3
+    INST_FMV_S_X    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 90 : RISCV_DEC_OP_0x53_F2_0x0_R3_0x8_R2
+    DEC_ILLEGAL     , INST_FCVT_S_D   , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 91 : RISCV_DEC_OP_0x53_F2_0x1_R3
+    INST_FADD_D     , INST_FSUB_D     , INST_FMUL_D     , INST_FDIV_D,
+    DEC_NODE(93)    , DEC_NODE(94)    , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_NODE(95)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_NODE(92),
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_NODE(96)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_NODE(99)    , DEC_ILLEGAL     , DEC_NODE(100)   , DEC_ILLEGAL,
+    DEC_NODE(97)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 92 : RISCV_DEC_OP_0x53_F2_0x1_R3_0xb_R2
+    INST_FSQRT_D    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 93 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x4_F3
+    INST_FSGNJ_D    , INST_FSGNJN_D   , INST_FSGNJX_D   , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 94 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x5_F3
+    INST_FMIN_D     , INST_FMAX_D     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 95 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x8_R2
+    INST_FCVT_D_S   , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 96 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x14_F3
+    INST_FLE_D      , INST_FLT_D      , INST_FEQ_D      , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 97 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x1c_R2
+    DEC_NODE(98)    , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 98 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x1c_R2_0x0_F3
+    DEC_ILLEGAL     , INST_FCLASS_D   , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 99 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x18_R2
+    INST_FCVT_W_D   , INST_FCVT_WU_D  , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    // 100 : RISCV_DEC_OP_0x53_F2_0x1_R3_0x1a_R2
+    INST_FCVT_D_W   , INST_FCVT_D_WU  , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+    DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL     , DEC_ILLEGAL,
+};
+
+
+uint32_t RISCV_DEC (uint32_t inst_hex)
+{
+    uint32_t node = 0;
+    for (uint32_t depth = 0; depth < DEC_MAX_DEPTH; depth++) {
+        const decNode *dec = &dec_nodes[node];
+        uint16_t entry = dec_entries[dec->base + ((inst_hex >> dec->shift) & dec->mask)];
+        if (entry == DEC_ILLEGAL) {
+            return -1;
+        }
+        if (!(entry & DEC_NODE_FLAG)) {
+            return entry;
+        }
+        node = entry & ~DEC_NODE_FLAG;
+    }
+    return -1;
+}
+
+
+uint32_t RISCV_EXPAND_RVC (uint32_t inst_hex)
+{
+    uint32_t imm;
+
+    switch (((inst_hex >> 11) & 0x1c) | (inst_hex & 0x03)) {
+    case 0x00 :
+        {  // c.addi4spn
+            imm = ((inst_hex >> 7) & 0x00030) |
+                  ((inst_hex >> 1) & 0x003c0) |
+                  ((inst_hex >> 4) & 0x00004) |
+                  ((inst_hex >> 2) & 0x00008);
+            if (imm == 0) {
+                return 0;
+            }
+            return 0x00000013 |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 7) |
+                   (2 << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x01 :
+        {  // c.addi
+            imm = ((inst_hex >> 7) & 0x00020) |
+                  ((inst_hex >> 2) & 0x0001f);
+            imm = (uint32_t)((int32_t)(imm << 26) >> 26);
+            return 0x00000013 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (((inst_hex >> 7) & 0x1f) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x02 :
+        if ((inst_hex & 0xf003) == 0x0002) {  // c.slli
+            imm = ((inst_hex >> 2) & 0x0001f);
+            return 0x00001013 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (((inst_hex >> 7) & 0x1f) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+        return 0;
+    case 0x04 :
+        {  // c.fld
+            imm = ((inst_hex >> 7) & 0x00038) |
+                  ((inst_hex << 1) & 0x000c0);
+            return 0x00003007 |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x05 :
+        {  // c.jal
+            imm = ((inst_hex >> 1) & 0x00800) |
+                  ((inst_hex >> 7) & 0x00010) |
+                  ((inst_hex >> 1) & 0x00300) |
+                  ((inst_hex << 2) & 0x00400) |
+                  ((inst_hex >> 1) & 0x00040) |
+                  ((inst_hex << 1) & 0x00080) |
+                  ((inst_hex >> 2) & 0x0000e) |
+                  ((inst_hex << 3) & 0x00020);
+            imm = (uint32_t)((int32_t)(imm << 20) >> 20);
+            return 0x0000006f |
+                   (1 << 7) |
+                   ((imm & 0x100000) << 11) | ((imm & 0x7fe) << 20) | ((imm & 0x800) << 9) | (imm & 0xff000);
+        }
+    case 0x06 :
+        {  // c.fldsp
+            imm = ((inst_hex >> 7) & 0x00020) |
+                  ((inst_hex >> 2) & 0x00018) |
+                  ((inst_hex << 4) & 0x001c0);
+            return 0x00003007 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (2 << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x08 :
+        {  // c.lw
+            imm = ((inst_hex >> 7) & 0x00038) |
+                  ((inst_hex >> 4) & 0x00004) |
+                  ((inst_hex << 1) & 0x00040);
+            return 0x00002003 |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x09 :
+        {  // c.li
+            imm = ((inst_hex >> 7) & 0x00020) |
+                  ((inst_hex >> 2) & 0x0001f);
+            imm = (uint32_t)((int32_t)(imm << 26) >> 26);
+            return 0x00000013 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x0a :
+        if ((inst_hex & 0xef83) == 0x4002) {  // reserved
+            return 0;
+        }
+        {  // c.lwsp
+            imm = ((inst_hex >> 7) & 0x00020) |
+                  ((inst_hex >> 2) & 0x0001c) |
+                  ((inst_hex << 4) & 0x000c0);
+            return 0x00002003 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (2 << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x0c :
+        {  // c.flw
+            imm = ((inst_hex >> 7) & 0x00038) |
+                  ((inst_hex >> 4) & 0x00004) |
+                  ((inst_hex << 1) & 0x00040);
+            return 0x00002007 |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x0d :
+        if ((inst_hex & 0xef83) == 0x6101) {  // c.addi16sp
+            imm = ((inst_hex >> 3) & 0x00200) |
+                  ((inst_hex >> 2) & 0x00010) |
+                  ((inst_hex << 1) & 0x00040) |
+                  ((inst_hex << 4) & 0x00180) |
+                  ((inst_hex << 3) & 0x00020);
+            if (imm == 0) {
+                return 0;
+            }
+            imm = (uint32_t)((int32_t)(imm << 22) >> 22);
+            return 0x00000013 |
+                   (2 << 7) |
+                   (2 << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+        {  // c.lui
+            imm = ((inst_hex << 5) & 0x20000) |
+                  ((inst_hex << 10) & 0x1f000);
+            if (imm == 0) {
+                return 0;
+            }
+            imm = (uint32_t)((int32_t)(imm << 14) >> 14);
+            return 0x00000037 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (imm & 0xfffff000);
+        }
+    case 0x0e :
+        {  // c.flwsp
+            imm = ((inst_hex >> 7) & 0x00020) |
+                  ((inst_hex >> 2) & 0x0001c) |
+                  ((inst_hex << 4) & 0x000c0);
+            return 0x00002007 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (2 << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+    case 0x11 :
+        if ((inst_hex & 0xfc03) == 0x8001) {  // c.srli
+            imm = ((inst_hex >> 2) & 0x0001f);
+            return 0x00005013 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+        if ((inst_hex & 0xfc03) == 0x8401) {  // c.srai
+            imm = ((inst_hex >> 2) & 0x0001f);
+            return 0x40005013 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+        if ((inst_hex & 0xec03) == 0x8801) {  // c.andi
+            imm = ((inst_hex >> 7) & 0x00020) |
+                  ((inst_hex >> 2) & 0x0001f);
+            imm = (uint32_t)((int32_t)(imm << 26) >> 26);
+            return 0x00007013 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0xfff) << 20);
+        }
+        if ((inst_hex & 0xfc63) == 0x8c01) {  // c.sub
+            return 0x40000033 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 20);
+        }
+        if ((inst_hex & 0xfc63) == 0x8c21) {  // c.xor
+            return 0x00004033 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 20);
+        }
+        if ((inst_hex & 0xfc63) == 0x8c41) {  // c.or
+            return 0x00006033 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 20);
+        }
+        if ((inst_hex & 0xfc63) == 0x8c61) {  // c.and
+            return 0x00007033 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 7) |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 20);
+        }
+        return 0;
+    case 0x12 :
+        if ((inst_hex & 0xffff) == 0x8002) {  // reserved
+            return 0;
+        }
+        if ((inst_hex & 0xf07f) == 0x8002) {  // c.jr
+            return 0x00000067 |
+                   (((inst_hex >> 7) & 0x1f) << 15);
+        }
+        if ((inst_hex & 0xf003) == 0x8002) {  // c.mv
+            return 0x00000033 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (((inst_hex >> 2) & 0x1f) << 20);
+        }
+        if (inst_hex == 0x9002) {  // c.ebreak
+            return 0x00100073;
+        }
+        if ((inst_hex & 0xf07f) == 0x9002) {  // c.jalr
+            return 0x00000067 |
+                   (1 << 7) |
+                   (((inst_hex >> 7) & 0x1f) << 15);
+        }
+        if ((inst_hex & 0xf003) == 0x9002) {  // c.add
+            return 0x00000033 |
+                   (((inst_hex >> 7) & 0x1f) << 7) |
+                   (((inst_hex >> 7) & 0x1f) << 15) |
+                   (((inst_hex >> 2) & 0x1f) << 20);
+        }
+        return 0;
+    case 0x14 :
+        {  // c.fsd
+            imm = ((inst_hex >> 7) & 0x00038) |
+                  ((inst_hex << 1) & 0x000c0);
+            return 0x00003027 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 20) |
+                   ((imm & 0xfe0) << 20) | ((imm & 0x01f) << 7);
+        }
+    case 0x15 :
+        {  // c.j
+            imm = ((inst_hex >> 1) & 0x00800) |
+                  ((inst_hex >> 7) & 0x00010) |
+                  ((inst_hex >> 1) & 0x00300) |
+                  ((inst_hex << 2) & 0x00400) |
+                  ((inst_hex >> 1) & 0x00040) |
+                  ((inst_hex << 1) & 0x00080) |
+                  ((inst_hex >> 2) & 0x0000e) |
+                  ((inst_hex << 3) & 0x00020);
+            imm = (uint32_t)((int32_t)(imm << 20) >> 20);
+            return 0x0000006f |
+                   ((imm & 0x100000) << 11) | ((imm & 0x7fe) << 20) | ((imm & 0x800) << 9) | (imm & 0xff000);
+        }
+    case 0x16 :
+        {  // c.fsdsp
+            imm = ((inst_hex >> 7) & 0x00038) |
+                  ((inst_hex >> 1) & 0x001c0);
+            return 0x00003027 |
+                   (2 << 15) |
+                   (((inst_hex >> 2) & 0x1f) << 20) |
+                   ((imm & 0xfe0) << 20) | ((imm & 0x01f) << 7);
+        }
+    case 0x18 :
+        {  // c.sw
+            imm = ((inst_hex >> 7) & 0x00038) |
+                  ((inst_hex >> 4) & 0x00004) |
+                  ((inst_hex << 1) & 0x00040);
+            return 0x00002023 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 20) |
+                   ((imm & 0xfe0) << 20) | ((imm & 0x01f) << 7);
+        }
+    case 0x19 :
+        {  // c.beqz
+            imm = ((inst_hex >> 4) & 0x00100) |
+                  ((inst_hex >> 7) & 0x00018) |
+                  ((inst_hex << 1) & 0x000c0) |
+                  ((inst_hex >> 2) & 0x00006) |
+                  ((inst_hex << 3) & 0x00020);
+            imm = (uint32_t)((int32_t)(imm << 23) >> 23);
+            return 0x00000063 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0x1000) << 19) | ((imm & 0x7e0) << 20) | ((imm & 0x01e) << 7) | ((imm & 0x800) >> 4);
+        }
+    case 0x1a :
+        {  // c.swsp
+            imm = ((inst_hex >> 7) & 0x0003c) |
+                  ((inst_hex >> 1) & 0x000c0);
+            return 0x00002023 |
+                   (2 << 15) |
+                   (((inst_hex >> 2) & 0x1f) << 20) |
+                   ((imm & 0xfe0) << 20) | ((imm & 0x01f) << 7);
+        }
+    case 0x1c :
+        {  // c.fsw
+            imm = ((inst_hex >> 7) & 0x00038) |
+                  ((inst_hex >> 4) & 0x00004) |
+                  ((inst_hex << 1) & 0x00040);
+            return 0x00002027 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((((inst_hex >> 2) & 0x07) + 8) << 20) |
+                   ((imm & 0xfe0) << 20) | ((imm & 0x01f) << 7);
+        }
+    case 0x1d :
+        {  // c.bnez
+            imm = ((inst_hex >> 4) & 0x00100) |
+                  ((inst_hex >> 7) & 0x00018) |
+                  ((inst_hex << 1) & 0x000c0) |
+                  ((inst_hex >> 2) & 0x00006) |
+                  ((inst_hex << 3) & 0x00020);
+            imm = (uint32_t)((int32_t)(imm << 23) >> 23);
+            return 0x00001063 |
+                   ((((inst_hex >> 7) & 0x07) + 8) << 15) |
+                   ((imm & 0x1000) << 19) | ((imm & 0x7e0) << 20) | ((imm & 0x01e) << 7) | ((imm & 0x800) >> 4);
+        }
+    case 0x1e :
+        {  // c.fswsp
+            imm = ((inst_hex >> 7) & 0x0003c) |
+                  ((inst_hex >> 1) & 0x000c0);
+            return 0x00002027 |
+                   (2 << 15) |
+                   (((inst_hex >> 2) & 0x1f) << 20) |
+                   ((imm & 0xfe0) << 20) | ((imm & 0x01f) << 7);
+        }
+    default :
+        return 0;
+    }
+}
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#pragma once
+
+#include <stdint.h>
+#include "./basic.h"
+#include "./inst_list.h"
+
+
+typedef struct {
+    RegAddr_t rd;
+    RegAddr_t rs1;
+    RegAddr_t rs2;
+} instOperandR;
+
+typedef struct {
+    RegAddr_t rd;
+    RegAddr_t rs1;
+    RegAddr_t rs2;
+    RegAddr_t rs3;
+} instOperandR4;
+
+typedef struct {
+    RegAddr_t rd;
+    RegAddr_t rs1;
+    Word_t    imm;
+} instOperandI;
+
+typedef struct {
+    RegAddr_t rs1;
+    RegAddr_t rs2;
+    Word_t    imm;
+} instOperandS;
+
+typedef struct {
+    RegAddr_t rs1;
+    RegAddr_t rs2;
+    Word_t    imm;
+} instOperandSB;
+
+typedef struct {
+    RegAddr_t rd;
+    Word_t    imm;
+} instOperandU;
+
+typedef struct {
+    RegAddr_t rd;
+    Word_t    imm;
+} instOperandUJ;
+
+/*!
+ * operands of an instruction, extracted once at decode time.
+ * member is selected by the format of the major opcode.
+ */
+typedef union {
+    instOperandR   r;
+    instOperandR4  r4;
+    instOperandI   i;
+    instOperandS   s;
+    instOperandSB  sb;
+    instOperandU   u;
+    instOperandUJ  uj;
+} instOperands;
+
+/*!
+ * format of operands, instOperandNone if instruction has no member
+ */
+typedef enum {
+    instOperandNone = 0,
+    instOperandRFormat,
+    instOperandR4Format,
+    instOperandIFormat,
+    instOperandSFormat,
+    instOperandSBFormat,
+    instOperandUFormat,
+    instOperandUJFormat,
+} instOperandFormat;
+
+static inline instOperandR DecodeOperandR (uint32_t hex)
+{
+    instOperandR op;
+    op.rd  = (hex >>  7) & 0x1f;
+    op.rs1 = (hex >> 15) & 0x1f;
+    op.rs2 = (hex >> 20) & 0x1f;
+    return op;
+}
+
+static inline instOperandR4 DecodeOperandR4 (uint32_t hex)
+{
+    instOperandR4 op;
+    op.rd  = (hex >>  7) & 0x1f;
+    op.rs1 = (hex >> 15) & 0x1f;
+    op.rs2 = (hex >> 20) & 0x1f;
+    op.rs3 = (hex >> 27) & 0x1f;
+    return op;
+}
+
+static inline instOperandI DecodeOperandI (uint32_t hex)
+{
+    instOperandI op;
+    op.rd  = (hex >>  7) & 0x1f;
+    op.rs1 = (hex >> 15) & 0x1f;
+    uint32_t imm = ((hex >> 20) & 0xfff);
+    op.imm = (Word_t)(imm << 20) >> 20;
+    return op;
+}
+
+static inline instOperandS DecodeOperandS (uint32_t hex)
+{
+    instOperandS op;
+    op.rs1 = (hex >> 15) & 0x1f;
+    op.rs2 = (hex >> 20) & 0x1f;
+    uint32_t imm = (((hex >> 25) & 0x07f) <<  5) |
+                   ((hex >>  7) & 0x01f);
+    op.imm = (Word_t)(imm << 20) >> 20;
+    return op;
+}
+
+static inline instOperandSB DecodeOperandSB (uint32_t hex)
+{
+    instOperandSB op;
+    op.rs1 = (hex >> 15) & 0x1f;
+    op.rs2 = (hex >> 20) & 0x1f;
+    uint32_t imm = (((hex >> 31) & 0x001) << 12) |
+                   (((hex >>  7) & 0x001) << 11) |
+                   (((hex >> 25) & 0x03f) <<  5) |
+                   (((hex >>  8) & 0x00f) <<  1);
+    op.imm = (Word_t)(imm << 19) >> 19;
+    return op;
+}
+
+static inline instOperandU DecodeOperandU (uint32_t hex)
+{
+    instOperandU op;
+    op.rd  = (hex >>  7) & 0x1f;
+    uint32_t imm = (hex & 0xfffff000);
+    op.imm = (Word_t)imm;
+    return op;
+}
+
+static inline instOperandUJ DecodeOperandUJ (uint32_t hex)
+{
+    instOperandUJ op;
+    op.rd  = (hex >>  7) & 0x1f;
+    uint32_t imm = (((hex >> 31) & 0x001) << 20) |
+                   (hex & 0x000ff000) |
+                   (((hex >> 20) & 0x001) << 11) |
+                   (((hex >> 21) & 0x3ff) <<  1);
+    op.imm = (Word_t)(imm << 11) >> 11;
+    return op;
+}
+
+/*!
+ * extract operands of decoded instruction
+ * \param inst_idx  result of RISCV_DEC
+ * \param hex       raw instruction
+ * \param op        extracted operands
+ * \return          format of operands, member of op which is filled
+ */
+static inline instOperandFormat DecodeInstOperands (uint32_t inst_idx, uint32_t hex, instOperands *op)
+{
+    switch (inst_idx) {
+    case INST_ADD :
+    case INST_SUB :
+    case INST_SLL :
+    case INST_SLT :
+    case INST_SLTU :
+    case INST_XOR :
+    case INST_SRL :
+    case INST_SRA :
+    case INST_OR :
+    case INST_AND :
+    case INST_MUL :
+    case INST_MULH :
+    case INST_MULHSU :
+    case INST_MULHU :
+    case INST_DIV :
+    case INST_DIVU :
+    case INST_REM :
+    case INST_REMU :
+    case INST_LR_W :
+    case INST_SC_W :
+    case INST_AMOSWAP_W :
+    case INST_AMOADD_W :
+    case INST_AMOXOR_W :
+    case INST_AMOAND_W :
+    case INST_AMOOR_W :
+    case INST_AMOMIN_W :
+    case INST_AMOMAX_W :
+    case INST_AMOMINU_W :
+    case INST_AMOMAXU_W :
+    case INST_FADD_S :
+    case INST_FSUB_S :
+    case INST_FMUL_S :
+    case INST_FDIV_S :
+    case INST_FSQRT_S :
+    case INST_FSGNJ_S :
+    case INST_FSGNJN_S :
+    case INST_FSGNJX_S :
+    case INST_FMIN_S :
+    case INST_FMAX_S :
+    case INST_FCVT_W_S :
+    case INST_FCVT_WU_S :
+    case INST_FMV_X_S :
+    case INST_FEQ_S :
+    case INST_FLT_S :
+    case INST_FLE_S :
+    case INST_FCLASS_S :
+    case INST_FCVT_S_W :
+    case INST_FCVT_S_WU :
+    case INST_FMV_S_X :
+    case INST_FADD_D :
+    case INST_FSUB_D :
+    case INST_FMUL_D :
+    case INST_FDIV_D :
+    case INST_FSQRT_D :
+    case INST_FSGNJ_D :
+    case INST_FSGNJN_D :
+    case INST_FSGNJX_D :
+    case INST_FMIN_D :
+    case INST_FMAX_D :
+    case INST_FCVT_S_D :
+    case INST_FCVT_D_S :
+    case INST_FEQ_D :
+    case INST_FLT_D :
+    case INST_FLE_D :
+    case INST_FCLASS_D :
+    case INST_FCVT_W_D :
+    case INST_FCVT_WU_D :
+    case INST_FCVT_D_W :
+    case INST_FCVT_D_WU :
+        op->r = DecodeOperandR (hex);
+        return instOperandRFormat;
+    case INST_FMADD_S :
+    case INST_FMSUB_S :
+    case INST_FNMSUB_S :
+    case INST_FNMADD_S :
+    case INST_FMADD_D :
+    case INST_FMSUB_D :
+    case INST_FNMSUB_D :
+    case INST_FNMADD_D :
+        op->r4 = DecodeOperandR4 (hex);
+        return instOperandR4Format;
+    case INST_JALR :
+    case INST_LB :
+    case INST_LH :
+    case INST_LW :
+    case INST_LBU :
+    case INST_LHU :
+    case INST_ADDI :
+    case INST_SLTI :
+    case INST_SLTIU :
+    case INST_XORI :
+    case INST_ORI :
+    case INST_ANDI :
+    case INST_SLLI :
+    case INST_SRLI :
+    case INST_SRAI :
+    case INST_FENCE :
+    case INST_FENCE_I :
+    case INST_SCALL :
+    case INST_SBREAK :
+    case INST_RDCYCLE :
+    case INST_RDCYCLEH :
+    case INST_RDTIME :
+    case INST_RDTIMEH :
+    case INST_RDINSTRET :
+    case INST_RDINSTRETH :
+    case INST_FLW :
+    case INST_FRCSR :
+    case INST_FRRM :
+    case INST_FRFLAGS :
+    case INST_FSCSR :
+    case INST_FSRM :
+    case INST_FSFLAGS :
+    case INST_FSRMI :
+    case INST_FSFLAGSI :
+    case INST_FLD :
+        op->i = DecodeOperandI (hex);
+        return instOperandIFormat;
+    case INST_SB :
+    case INST_SH :
+    case INST_SW :
+    case INST_FSW :
+    case INST_FSD :
+        op->s = DecodeOperandS (hex);
+        return instOperandSFormat;
+    case INST_BEQ :
+    case INST_BNE :
+    case INST_BLT :
+    case INST_BGE :
+    case INST_BLTU :
+    case INST_BGEU :
+        op->sb = DecodeOperandSB (hex);
+        return instOperandSBFormat;
+    case INST_LUI :
+    case INST_AUIPC :
+        op->u = DecodeOperandU (hex);
+        return instOperandUFormat;
+    case INST_JAL :
+        op->uj = DecodeOperandUJ (hex);
+        return instOperandUJFormat;
+    default :
+        return instOperandNone;
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#pragma once
+
+
+#define INST_LUI		0
+#define INST_AUIPC		1
+#define INST_JAL		2
+#define INST_JALR		3
+#define INST_BEQ		4
+#define INST_BNE		5
+#define INST_BLT		6
+#define INST_BGE		7
+#define INST_BLTU		8
+#define INST_BGEU		9
+#define INST_LB		10
+#define INST_LH		11
+#define INST_LW		12
+#define INST_LBU		13
+#define INST_LHU		14
+#define INST_SB		15
+#define INST_SH		16
+#define INST_SW		17
+#define INST_ADDI		18
+#define INST_SLTI		19
+#define INST_SLTIU		20
+#define INST_XORI		21
+#define INST_ORI		22
+#define INST_ANDI		23
+#define INST_SLLI		24
+#define INST_SRLI		25
+#define INST_SRAI		26
+#define INST_ADD		27
+#define INST_SUB		28
+#define INST_SLL		29
+#define INST_SLT		30
+#define INST_SLTU		31
+#define INST_XOR		32
+#define INST_SRL		33
+#define INST_SRA		34
+#define INST_OR		35
+#define INST_AND		36
+#define INST_FENCE		37
+#define INST_FENCE_I		38
+#define INST_SCALL		39
+#define INST_SBREAK		40
+#define INST_RDCYCLE		41
+#define INST_RDCYCLEH		42
+#define INST_RDTIME		43
+#define INST_RDTIMEH		44
+#define INST_RDINSTRET		45
+#define INST_RDINSTRETH		46
+#define INST_MUL		47
+#define INST_MULH		48
+#define INST_MULHSU		49
+#define INST_MULHU		50
+#define INST_DIV		51
+#define INST_DIVU		52
+#define INST_REM		53
+#define INST_REMU		54
+#define INST_LR_W		55
+#define INST_SC_W		56
+#define INST_AMOSWAP_W		57
+#define INST_AMOADD_W		58
+#define INST_AMOXOR_W		59
+#define INST_AMOAND_W		60
+#define INST_AMOOR_W		61
+#define INST_AMOMIN_W		62
+#define INST_AMOMAX_W		63
+#define INST_AMOMINU_W		64
+#define INST_AMOMAXU_W		65
+#define INST_FLW		66
+#define INST_FSW		67
+#define INST_FMADD_S		68
+#define INST_FMSUB_S		69
+#define INST_FNMSUB_S		70
+#define INST_FNMADD_S		71
+#define INST_FADD_S		72
+#define INST_FSUB_S		73
+#define INST_FMUL_S		74
+#define INST_FDIV_S		75
+#define INST_FSQRT_S		76
+#define INST_FSGNJ_S		77
+#define INST_FSGNJN_S		78
+#define INST_FSGNJX_S		79
+#define INST_FMIN_S		80
+#define INST_FMAX_S		81
+#define INST_FCVT_W_S		82
+#define INST_FCVT_WU_S		83
+#define INST_FMV_X_S		84
+#define INST_FEQ_S		85
+#define INST_FLT_S		86
+#define INST_FLE_S		87
+#define INST_FCLASS_S		88
+#define INST_FCVT_S_W		89
+#define INST_FCVT_S_WU		90
+#define INST_FMV_S_X		91
+#define INST_FRCSR		92
+#define INST_FRRM		93
+#define INST_FRFLAGS		94
+#define INST_FSCSR		95
+#define INST_FSRM		96
+#define INST_FSFLAGS		97
+#define INST_FSRMI		98
+#define INST_FSFLAGSI		99
+#define INST_FLD		100
+#define INST_FSD		101
+#define INST_FMADD_D		102
+#define INST_FMSUB_D		103
+#define INST_FNMSUB_D		104
+#define INST_FNMADD_D		105
+#define INST_FADD_D		106
+#define INST_FSUB_D		107
+#define INST_FMUL_D		108
+#define INST_FDIV_D		109
+#define INST_FSQRT_D		110
+#define INST_FSGNJ_D		111
+#define INST_FSGNJN_D		112
+#define INST_FSGNJX_D		113
+#define INST_FMIN_D		114
+#define INST_FMAX_D		115
+#define INST_FCVT_S_D		116
+#define INST_FCVT_D_S		117
+#define INST_FEQ_D		118
+#define INST_FLT_D		119
+#define INST_FLE_D		120
+#define INST_FCLASS_D		121
+#define INST_FCVT_W_D		122
+#define INST_FCVT_WU_D		123
+#define INST_FCVT_D_W		124
+#define INST_FCVT_D_WU		125
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#include "./inst_list.h"
+#include "./inst_operand.h"
+
+
+const char inst_strings[126][INST_STRING_SIZE] = {
+    [INST_LUI] = "lui        @,@",
+    [INST_AUIPC] = "auipc      @,@",
+    [INST_JAL] = "jal        @,@",
+    [INST_JALR] = "jalr       @,@,@",
+    [INST_BEQ] = "beq        @,@,@",
+    [INST_BNE] = "bne        @,@,@",
+    [INST_BLT] = "blt        @,@,@",
+    [INST_BGE] = "bge        @,@,@",
+    [INST_BLTU] = "bltu       @,@,@",
+    [INST_BGEU] = "bgeu       @,@,@",
+    [INST_LB] = "lb         @,@,@",
+    [INST_LH] = "lh         @,@,@",
+    [INST_LW] = "lw         @,@,@",
+    [INST_LBU] = "lbu        @,@,@",
+    [INST_LHU] = "lhu        @,@,@",
+    [INST_SB] = "sb         @,@,@|@",
+    [INST_SH] = "sh         @,@,@|@",
+    [INST_SW] = "sw         @,@,@|@",
+    [INST_ADDI] = "addi       @,@,@",
+    [INST_SLTI] = "slti       @,@,@",
+    [INST_SLTIU] = "sltiu      @,@,@",
+    [INST_XORI] = "xori       @,@,@",
+    [INST_ORI] = "ori        @,@,@",
+    [INST_ANDI] = "andi       @,@,@",
+    [INST_SLLI] = "slli       @,@,@",
+    [INST_SRLI] = "srli       @,@,@",
+    [INST_SRAI] = "srai       @,@,@",
+    [INST_ADD] = "add        @,@,@",
+    [INST_SUB] = "sub        @,@,@",
+    [INST_SLL] = "sll        @,@,@",
+    [INST_SLT] = "slt        @,@,@",
+    [INST_SLTU] = "sltu       @,@,@",
+    [INST_XOR] = "xor        @,@,@",
+    [INST_SRL] = "srl        @,@,@",
+    [INST_SRA] = "sra        @,@,@",
+    [INST_OR] = "or         @,@,@",
+    [INST_AND] = "and        @,@,@",
+    [INST_FENCE] = "fence",
+    [INST_FENCE_I] = "fence.i",
+    [INST_SCALL] = "scall",
+    [INST_SBREAK] = "sbreak",
+    [INST_RDCYCLE] = "rdcycle    @",
+    [INST_RDCYCLEH] = "rdcycleh   @",
+    [INST_RDTIME] = "rdtime     @",
+    [INST_RDTIMEH] = "rdtimeh    @",
+    [INST_RDINSTRET] = "rdinstret  @",
+    [INST_RDINSTRETH] = "rdinstreth @",
+    [INST_MUL] = "mul        @,@,@",
+    [INST_MULH] = "mulh       @,@,@",
+    [INST_MULHSU] = "mulhsu     @,@,@",
+    [INST_MULHU] = "mulhu      @,@,@",
+    [INST_DIV] = "div        @,@,@",
+    [INST_DIVU] = "divu       @,@,@",
+    [INST_REM] = "rem        @,@,@",
+    [INST_REMU] = "remu       @,@,@",
+    [INST_LR_W] = "lr.w       @,@",
+    [INST_SC_W] = "sc.w       @,@,@",
+    [INST_AMOSWAP_W] = "amoswap.w  @,@,@",
+    [INST_AMOADD_W] = "amoadd.w   @,@,@",
+    [INST_AMOXOR_W] = "amoxor.w   @,@,@",
+    [INST_AMOAND_W] = "amoand.w   @,@,@",
+    [INST_AMOOR_W] = "amoor.w    @,@,@",
+    [INST_AMOMIN_W] = "amomin.w   @,@,@",
+    [INST_AMOMAX_W] = "amomax.w   @,@,@",
+    [INST_AMOMINU_W] = "amominu.w  @,@,@",
+    [INST_AMOMAXU_W] = "amomaxu.w  @,@,@",
+    [INST_FLW] = "flw        @,@,@",
+    [INST_FSW] = "fsw        @,@,@|@",
+    [INST_FMADD_S] = "fmadd.s    @,@,@,@",
+    [INST_FMSUB_S] = "fmsub.s    @,@,@,@",
+    [INST_FNMSUB_S] = "fnmsub.s   @,@,@,@",
+    [INST_FNMADD_S] = "fnmadd.s   @,@,@,@",
+    [INST_FADD_S] = "fadd.s     @,@,@",
+    [INST_FSUB_S] = "fsub.s     @,@,@",
+    [INST_FMUL_S] = "fmul.s     @,@,@",
+    [INST_FDIV_S] = "fdiv.s     @,@,@",
+    [INST_FSQRT_S] = "fsqrt.s    @,@",
+    [INST_FSGNJ_S] = "fsgnj.s    @,@,@",
+    [INST_FSGNJN_S] = "fsgnjn.s   @,@,@",
+    [INST_FSGNJX_S] = "fsgnjx.s   @,@,@",
+    [INST_FMIN_S] = "fmin.s     @,@,@",
+    [INST_FMAX_S] = "fmax.s     @,@,@",
+    [INST_FCVT_W_S] = "fcvt.w.s   @,@",
+    [INST_FCVT_WU_S] = "fcvt.wu.s  @,@",
+    [INST_FMV_X_S] = "fmv.x.s    @,@",
+    [INST_FEQ_S] = "feq.s      @,@,@",
+    [INST_FLT_S] = "flt.s      @,@,@",
+    [INST_FLE_S] = "fle.s      @,@,@",
+    [INST_FCLASS_S] = "fclass.s   @,@",
+    [INST_FCVT_S_W] = "fcvt.s.w   @,@",
+    [INST_FCVT_S_WU] = "fcvt.s.wu  @,@",
+    [INST_FMV_S_X] = "fmv.s.x    @,@",
+    [INST_FRCSR] = "frcsr      @",
+    [INST_FRRM] = "frrm       @",
+    [INST_FRFLAGS] = "frflags    @",
+    [INST_FSCSR] = "fscsr      @,@",
+    [INST_FSRM] = "fsrm       @,@",
+    [INST_FSFLAGS] = "fsflags    @,@",
+    [INST_FSRMI] = "fsrmi      @",
+    [INST_FSFLAGSI] = "fsflagsi   @",
+    [INST_FLD] = "fld        @,@,@",
+    [INST_FSD] = "fsd        @,@,@|@",
+    [INST_FMADD_D] = "fmadd.d    @,@,@,@",
+    [INST_FMSUB_D] = "fmsub.d    @,@,@,@",
+    [INST_FNMSUB_D] = "fnmsub.d   @,@,@,@",
+    [INST_FNMADD_D] = "fnmadd.d   @,@,@,@",
+    [INST_FADD_D] = "fadd.d     @,@,@",
+    [INST_FSUB_D] = "fsub.d     @,@,@",
+    [INST_FMUL_D] = "fmul.d     @,@,@",
+    [INST_FDIV_D] = "fdiv.d     @,@,@",
+    [INST_FSQRT_D] = "fsqrt.d    @,@",
+    [INST_FSGNJ_D] = "fsgnj.d    @,@,@",
+    [INST_FSGNJN_D] = "fsgnjn.d   @,@,@",
+    [INST_FSGNJX_D] = "fsgnjx.d   @,@,@",
+    [INST_FMIN_D] = "fmin.d     @,@,@",
+    [INST_FMAX_D] = "fmax.d     @,@,@",
+    [INST_FCVT_S_D] = "fcvt.s.d   @,@",
+    [INST_FCVT_D_S] = "fcvt.d.s   @,@",
+    [INST_FEQ_D] = "feq.d      @,@,@",
+    [INST_FLT_D] = "flt.d      @,@,@",
+    [INST_FLE_D] = "fle.d      @,@,@",
+    [INST_FCLASS_D] = "fclass.d   @,@",
+    [INST_FCVT_W_D] = "fcvt.w.d   @,@",
+    [INST_FCVT_WU_D] = "fcvt.wu.d  @,@",
+    [INST_FCVT_D_W] = "fcvt.d.w   @,@",
+    [INST_FCVT_D_WU] = "fcvt.d.wu  @,@"};
+
+
+const printProgram inst_print_prog[126] = {
+    [INST_LUI] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 3, 12, 5, 16, 0xfffff } }, "lui        r,0x" },
+    [INST_AUIPC] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 3, 12, 5, 16, 0xfffff } }, "auipc      r,0x" },
+    [INST_JAL] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 3, 12, 5, 16, 0xfffff } }, "jal        r,0x" },
+    [INST_JALR] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 0, 3, 10, 0xfff } }, "jalr       r,r,r" },
+    [INST_BEQ] = { 3, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f } }, "beq        r,r,0x" },
+    [INST_BNE] = { 3, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f } }, "bne        r,r,0x" },
+    [INST_BLT] = { 3, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f } }, "blt        r,r,0x" },
+    [INST_BGE] = { 3, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f } }, "bge        r,r,0x" },
+    [INST_BLTU] = { 3, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f } }, "bltu       r,r,0x" },
+    [INST_BGEU] = { 3, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f } }, "bgeu       r,r,0x" },
+    [INST_LB] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "lb         r,r,0x" },
+    [INST_LH] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "lh         r,r,0x" },
+    [INST_LW] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "lw         r,r,0x" },
+    [INST_LBU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "lbu        r,r,0x" },
+    [INST_LHU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "lhu        r,r,0x" },
+    [INST_SB] = { 4, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f }, { 2, 7, 2, 10, 0x1f } }, "sb         r,r,0x|r" },
+    [INST_SH] = { 4, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f }, { 2, 7, 2, 10, 0x1f } }, "sh         r,r,0x|r" },
+    [INST_SW] = { 4, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f }, { 2, 7, 2, 10, 0x1f } }, "sw         r,r,0x|r" },
+    [INST_ADDI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "addi       r,r,0x" },
+    [INST_SLTI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "slti       r,r,0x" },
+    [INST_SLTIU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "sltiu      r,r,0x" },
+    [INST_XORI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "xori       r,r,0x" },
+    [INST_ORI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "ori        r,r,0x" },
+    [INST_ANDI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "andi       r,r,0x" },
+    [INST_SLLI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "slli       r,r,r" },
+    [INST_SRLI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "srli       r,r,r" },
+    [INST_SRAI] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "srai       r,r,r" },
+    [INST_ADD] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "add        r,r,r" },
+    [INST_SUB] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "sub        r,r,r" },
+    [INST_SLL] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "sll        r,r,r" },
+    [INST_SLT] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "slt        r,r,r" },
+    [INST_SLTU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "sltu       r,r,r" },
+    [INST_XOR] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "xor        r,r,r" },
+    [INST_SRL] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "srl        r,r,r" },
+    [INST_SRA] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "sra        r,r,r" },
+    [INST_OR] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "or         r,r,r" },
+    [INST_AND] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "and        r,r,r" },
+    [INST_FENCE] = { 0, 5, { { 0 } }, "fence" },
+    [INST_FENCE_I] = { 0, 7, { { 0 } }, "fence.i" },
+    [INST_SCALL] = { 0, 5, { { 0 } }, "scall" },
+    [INST_SBREAK] = { 0, 6, { { 0 } }, "sbreak" },
+    [INST_RDCYCLE] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "rdcycle    r" },
+    [INST_RDCYCLEH] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "rdcycleh   r" },
+    [INST_RDTIME] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "rdtime     r" },
+    [INST_RDTIMEH] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "rdtimeh    r" },
+    [INST_RDINSTRET] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "rdinstret  r" },
+    [INST_RDINSTRETH] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "rdinstreth r" },
+    [INST_MUL] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "mul        r,r,r" },
+    [INST_MULH] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "mulh       r,r,r" },
+    [INST_MULHSU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "mulhsu     r,r,r" },
+    [INST_MULHU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "mulhu      r,r,r" },
+    [INST_DIV] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "div        r,r,r" },
+    [INST_DIVU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "divu       r,r,r" },
+    [INST_REM] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "rem        r,r,r" },
+    [INST_REMU] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "remu       r,r,r" },
+    [INST_LR_W] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "lr.w       r,r" },
+    [INST_SC_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "sc.w       r,r,r" },
+    [INST_AMOSWAP_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amoswap.w  r,r,r" },
+    [INST_AMOADD_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amoadd.w   r,r,r" },
+    [INST_AMOXOR_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amoxor.w   r,r,r" },
+    [INST_AMOAND_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amoand.w   r,r,r" },
+    [INST_AMOOR_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amoor.w    r,r,r" },
+    [INST_AMOMIN_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amomin.w   r,r,r" },
+    [INST_AMOMAX_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amomax.w   r,r,r" },
+    [INST_AMOMINU_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amominu.w  r,r,r" },
+    [INST_AMOMAXU_W] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "amomaxu.w  r,r,r" },
+    [INST_FLW] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "flw        r,r,0x" },
+    [INST_FSW] = { 4, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f }, { 2, 7, 2, 10, 0x1f } }, "fsw        r,r,0x|r" },
+    [INST_FMADD_S] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fmadd.s    r,r,r,0x" },
+    [INST_FMSUB_S] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fmsub.s    r,r,r,0x" },
+    [INST_FNMSUB_S] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fnmsub.s   r,r,r,0x" },
+    [INST_FNMADD_S] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fnmadd.s   r,r,r,0x" },
+    [INST_FADD_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fadd.s     r,r,r" },
+    [INST_FSUB_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsub.s     r,r,r" },
+    [INST_FMUL_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fmul.s     r,r,r" },
+    [INST_FDIV_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fdiv.s     r,r,r" },
+    [INST_FSQRT_S] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fsqrt.s    r,r" },
+    [INST_FSGNJ_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsgnj.s    r,r,r" },
+    [INST_FSGNJN_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsgnjn.s   r,r,r" },
+    [INST_FSGNJX_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsgnjx.s   r,r,r" },
+    [INST_FMIN_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fmin.s     r,r,r" },
+    [INST_FMAX_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fmax.s     r,r,r" },
+    [INST_FCVT_W_S] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.w.s   r,r" },
+    [INST_FCVT_WU_S] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.wu.s  r,r" },
+    [INST_FMV_X_S] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fmv.x.s    r,r" },
+    [INST_FEQ_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "feq.s      r,r,r" },
+    [INST_FLT_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "flt.s      r,r,r" },
+    [INST_FLE_S] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fle.s      r,r,r" },
+    [INST_FCLASS_S] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fclass.s   r,r" },
+    [INST_FCVT_S_W] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.s.w   r,r" },
+    [INST_FCVT_S_WU] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.s.wu  r,r" },
+    [INST_FMV_S_X] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fmv.s.x    r,r" },
+    [INST_FRCSR] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "frcsr      r" },
+    [INST_FRRM] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "frrm       r" },
+    [INST_FRFLAGS] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "frflags    r" },
+    [INST_FSCSR] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fscsr      r,r" },
+    [INST_FSRM] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fsrm       r,r" },
+    [INST_FSFLAGS] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fsflags    r,r" },
+    [INST_FSRMI] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "fsrmi      r" },
+    [INST_FSFLAGSI] = { 1, 0, { { 12, 7, 2, 10, 0x1f } }, "fsflagsi   r" },
+    [INST_FLD] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 3, 20, 3, 16, 0xfff } }, "fld        r,r,0x" },
+    [INST_FSD] = { 4, 0, { { 12, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 25, 2, 16, 0x7f }, { 2, 7, 2, 10, 0x1f } }, "fsd        r,r,0x|r" },
+    [INST_FMADD_D] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fmadd.d    r,r,r,0x" },
+    [INST_FMSUB_D] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fmsub.d    r,r,r,0x" },
+    [INST_FNMSUB_D] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fnmsub.d   r,r,r,0x" },
+    [INST_FNMADD_D] = { 4, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f }, { 3, 27, 2, 16, 0x1f } }, "fnmadd.d   r,r,r,0x" },
+    [INST_FADD_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fadd.d     r,r,r" },
+    [INST_FSUB_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsub.d     r,r,r" },
+    [INST_FMUL_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fmul.d     r,r,r" },
+    [INST_FDIV_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fdiv.d     r,r,r" },
+    [INST_FSQRT_D] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fsqrt.d    r,r" },
+    [INST_FSGNJ_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsgnj.d    r,r,r" },
+    [INST_FSGNJN_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsgnjn.d   r,r,r" },
+    [INST_FSGNJX_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fsgnjx.d   r,r,r" },
+    [INST_FMIN_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fmin.d     r,r,r" },
+    [INST_FMAX_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fmax.d     r,r,r" },
+    [INST_FCVT_S_D] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.s.d   r,r" },
+    [INST_FCVT_D_S] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.d.s   r,r" },
+    [INST_FEQ_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "feq.d      r,r,r" },
+    [INST_FLT_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "flt.d      r,r,r" },
+    [INST_FLE_D] = { 3, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f }, { 2, 20, 2, 10, 0x1f } }, "fle.d      r,r,r" },
+    [INST_FCLASS_D] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fclass.d   r,r" },
+    [INST_FCVT_W_D] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.w.d   r,r" },
+    [INST_FCVT_WU_D] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.wu.d  r,r" },
+    [INST_FCVT_D_W] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.d.w   r,r" },
+    [INST_FCVT_D_WU] = { 2, 0, { { 12, 7, 2, 10, 0x1f }, { 2, 15, 2, 10, 0x1f } }, "fcvt.d.wu  r,r" }};
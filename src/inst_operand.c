@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#include <stdint.h>
+#include "./inst_list.h"
+#include "./inst_operand.h"
+
+
+const operandList inst_operand[126] = {
+    [INST_LUI] = { 2, { operandTypeDec, operandTypeHex }, { 11, 31 }, { 7, 12 } },
+    [INST_AUIPC] = { 2, { operandTypeDec, operandTypeHex }, { 11, 31 }, { 7, 12 } },
+    [INST_JAL] = { 2, { operandTypeDec, operandTypeUJ }, { 11, 31 }, { 7, 12 } },
+    [INST_JALR] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 11 }, { 7, 15, 0 } },
+    [INST_BEQ] = { 3, { operandTypeDec, operandTypeDec, operandTypeSB }, { 19, 24, 31 }, { 15, 20, 25 } },
+    [INST_BNE] = { 3, { operandTypeDec, operandTypeDec, operandTypeSB }, { 19, 24, 31 }, { 15, 20, 25 } },
+    [INST_BLT] = { 3, { operandTypeDec, operandTypeDec, operandTypeSB }, { 19, 24, 31 }, { 15, 20, 25 } },
+    [INST_BGE] = { 3, { operandTypeDec, operandTypeDec, operandTypeSB }, { 19, 24, 31 }, { 15, 20, 25 } },
+    [INST_BLTU] = { 3, { operandTypeDec, operandTypeDec, operandTypeSB }, { 19, 24, 31 }, { 15, 20, 25 } },
+    [INST_BGEU] = { 3, { operandTypeDec, operandTypeDec, operandTypeSB }, { 19, 24, 31 }, { 15, 20, 25 } },
+    [INST_LB] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_LH] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_LW] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_LBU] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_LHU] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_SB] = { 4, { operandTypeDec, operandTypeDec, operandTypeHex, operandTypeDec }, { 19, 24, 31, 11 }, { 15, 20, 25, 7 } },
+    [INST_SH] = { 4, { operandTypeDec, operandTypeDec, operandTypeHex, operandTypeDec }, { 19, 24, 31, 11 }, { 15, 20, 25, 7 } },
+    [INST_SW] = { 4, { operandTypeDec, operandTypeDec, operandTypeHex, operandTypeDec }, { 19, 24, 31, 11 }, { 15, 20, 25, 7 } },
+    [INST_ADDI] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_SLTI] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_SLTIU] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_XORI] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_ORI] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_ANDI] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_SLLI] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SRLI] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SRAI] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_ADD] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SUB] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SLL] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SLT] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SLTU] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_XOR] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SRL] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_SRA] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_OR] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AND] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FENCE] = { 0, {  }, {  }, {  } },
+    [INST_FENCE_I] = { 0, {  }, {  }, {  } },
+    [INST_SCALL] = { 0, {  }, {  }, {  } },
+    [INST_SBREAK] = { 0, {  }, {  }, {  } },
+    [INST_RDCYCLE] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_RDCYCLEH] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_RDTIME] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_RDTIMEH] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_RDINSTRET] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_RDINSTRETH] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_MUL] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_MULH] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_MULHSU] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_MULHU] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_DIV] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_DIVU] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_REM] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_REMU] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_LR_W] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_SC_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOSWAP_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOADD_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOXOR_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOAND_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOOR_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOMIN_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOMAX_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOMINU_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_AMOMAXU_W] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FLW] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_FSW] = { 4, { operandTypeDec, operandTypeDec, operandTypeHex, operandTypeDec }, { 19, 24, 31, 11 }, { 15, 20, 25, 7 } },
+    [INST_FMADD_S] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FMSUB_S] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FNMSUB_S] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FNMADD_S] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FADD_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSUB_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FMUL_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FDIV_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSQRT_S] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FSGNJ_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSGNJN_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSGNJX_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FMIN_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FMAX_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FCVT_W_S] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_WU_S] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FMV_X_S] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FEQ_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FLT_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FLE_S] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FCLASS_S] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_S_W] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_S_WU] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FMV_S_X] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FRCSR] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_FRRM] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_FRFLAGS] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_FSCSR] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FSRM] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FSFLAGS] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FSRMI] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_FSFLAGSI] = { 1, { operandTypeDec }, { 11 }, { 7 } },
+    [INST_FLD] = { 3, { operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 31 }, { 7, 15, 20 } },
+    [INST_FSD] = { 4, { operandTypeDec, operandTypeDec, operandTypeHex, operandTypeDec }, { 19, 24, 31, 11 }, { 15, 20, 25, 7 } },
+    [INST_FMADD_D] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FMSUB_D] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FNMSUB_D] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FNMADD_D] = { 4, { operandTypeDec, operandTypeDec, operandTypeDec, operandTypeHex }, { 11, 19, 24, 31 }, { 7, 15, 20, 27 } },
+    [INST_FADD_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSUB_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FMUL_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FDIV_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSQRT_D] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FSGNJ_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSGNJN_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FSGNJX_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FMIN_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FMAX_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FCVT_S_D] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_D_S] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FEQ_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FLT_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FLE_D] = { 3, { operandTypeDec, operandTypeDec, operandTypeDec }, { 11, 19, 24 }, { 7, 15, 20 } },
+    [INST_FCLASS_D] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_W_D] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_WU_D] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_D_W] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } },
+    [INST_FCVT_D_WU] = { 2, { operandTypeDec, operandTypeDec }, { 11, 19 }, { 7, 15 } }
+};
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#pragma once
+
+
+#include <stdint.h>
+#include "./inst_list.h"
+#include "./dec_utils.h"
+
+
+typedef enum {
+      operandTypeHex = 0, 
+      operandTypeDec = 1, 
+      operandTypeSB = 2, 
+      operandTypeUJ = 3 } operandType;
+
+#define MAX_OPERANDS 8
+
+typedef struct {
+    uint32_t size;
+    operandType type_lst[MAX_OPERANDS];
+    uint32_t msb_lst[MAX_OPERANDS];
+    uint32_t lsb_lst[MAX_OPERANDS];
+} operandList;
+
+extern const operandList inst_operand[126];
+
+#define INST_PRINT_TEXT_SIZE 23
+
+/*!
+ * format program of an instruction for the disassembler.
+ * text is the mnemonic string with operand prefixes (r / 0x) and
+ * without '@'. each step copies text_len characters of text, then
+ * prints (inst_hex >> lsb) & mask with digits characters in base.
+ */
+typedef struct {
+    uint8_t  text_len;
+    uint8_t  lsb;
+    uint8_t  digits;
+    uint8_t  base;
+    uint32_t mask;
+} printStep;
+typedef struct {
+    uint8_t    size;       // number of operands
+    uint8_t    tail_len;   // text after the last operand
+    printStep  step[MAX_OPERANDS];
+    char       text[INST_PRINT_TEXT_SIZE];
+} printProgram;
+extern const printProgram inst_print_prog[126];
+
+#define INST_STRING_SIZE 19
+extern const char inst_strings[126][INST_STRING_SIZE];
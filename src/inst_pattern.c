@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#include <stdint.h>
+#include "./inst_pattern.h"
+
+const instPattern inst_pattern[INST_PATTERN_NUM] = {
+    { 0x0000007f, 0x00000037, "lui" },  // INST_LUI
+    { 0x0000007f, 0x00000017, "auipc" },  // INST_AUIPC
+    { 0x0000007f, 0x0000006f, "jal" },  // INST_JAL
+    { 0x0000707f, 0x00000067, "jalr" },  // INST_JALR
+    { 0x0000707f, 0x00000063, "beq" },  // INST_BEQ
+    { 0x0000707f, 0x00001063, "bne" },  // INST_BNE
+    { 0x0000707f, 0x00004063, "blt" },  // INST_BLT
+    { 0x0000707f, 0x00005063, "bge" },  // INST_BGE
+    { 0x0000707f, 0x00006063, "bltu" },  // INST_BLTU
+    { 0x0000707f, 0x00007063, "bgeu" },  // INST_BGEU
+    { 0x0000707f, 0x00000003, "lb" },  // INST_LB
+    { 0x0000707f, 0x00001003, "lh" },  // INST_LH
+    { 0x0000707f, 0x00002003, "lw" },  // INST_LW
+    { 0x0000707f, 0x00004003, "lbu" },  // INST_LBU
+    { 0x0000707f, 0x00005003, "lhu" },  // INST_LHU
+    { 0x0000707f, 0x00000023, "sb" },  // INST_SB
+    { 0x0000707f, 0x00001023, "sh" },  // INST_SH
+    { 0x0000707f, 0x00002023, "sw" },  // INST_SW
+    { 0x0000707f, 0x00000013, "addi" },  // INST_ADDI
+    { 0x0000707f, 0x00002013, "slti" },  // INST_SLTI
+    { 0x0000707f, 0x00003013, "sltiu" },  // INST_SLTIU
+    { 0x0000707f, 0x00004013, "xori" },  // INST_XORI
+    { 0x0000707f, 0x00006013, "ori" },  // INST_ORI
+    { 0x0000707f, 0x00007013, "andi" },  // INST_ANDI
+    { 0xfe00707f, 0x00001013, "slli" },  // INST_SLLI
+    { 0xfe00707f, 0x00005013, "srli" },  // INST_SRLI
+    { 0xfe00707f, 0x40005013, "srai" },  // INST_SRAI
+    { 0xfe00707f, 0x00000033, "add" },  // INST_ADD
+    { 0xfe00707f, 0x40000033, "sub" },  // INST_SUB
+    { 0xfe00707f, 0x00001033, "sll" },  // INST_SLL
+    { 0xfe00707f, 0x00002033, "slt" },  // INST_SLT
+    { 0xfe00707f, 0x00003033, "sltu" },  // INST_SLTU
+    { 0xfe00707f, 0x00004033, "xor" },  // INST_XOR
+    { 0xfe00707f, 0x00005033, "srl" },  // INST_SRL
+    { 0xfe00707f, 0x40005033, "sra" },  // INST_SRA
+    { 0xfe00707f, 0x00006033, "or" },  // INST_OR
+    { 0xfe00707f, 0x00007033, "and" },  // INST_AND
+    { 0x000ff07f, 0x0000000f, "fence" },  // INST_FENCE
+    { 0xfffff07f, 0x0000100f, "fence.i" },  // INST_FENCE_I
+    { 0xfffff07f, 0x00000073, "scall" },  // INST_SCALL
+    { 0xfffff07f, 0x00100073, "sbreak" },  // INST_SBREAK
+    { 0xfffff07f, 0xc0002073, "rdcycle" },  // INST_RDCYCLE
+    { 0xfffff07f, 0xc8002073, "rdcycleh" },  // INST_RDCYCLEH
+    { 0xfffff07f, 0xc0102073, "rdtime" },  // INST_RDTIME
+    { 0xfffff07f, 0xc8102073, "rdtimeh" },  // INST_RDTIMEH
+    { 0xfffff07f, 0xc0202073, "rdinstret" },  // INST_RDINSTRET
+    { 0xfffff07f, 0xc8202073, "rdinstreth" },  // INST_RDINSTRETH
+    { 0xfe00707f, 0x02000033, "mul" },  // INST_MUL
+    { 0xfe00707f, 0x02001033, "mulh" },  // INST_MULH
+    { 0xfe00707f, 0x02002033, "mulhsu" },  // INST_MULHSU
+    { 0xfe00707f, 0x02003033, "mulhu" },  // INST_MULHU
+    { 0xfe00707f, 0x02004033, "div" },  // INST_DIV
+    { 0xfe00707f, 0x02005033, "divu" },  // INST_DIVU
+    { 0xfe00707f, 0x02006033, "rem" },  // INST_REM
+    { 0xfe00707f, 0x02007033, "remu" },  // INST_REMU
+    { 0xf9f0707f, 0x1000202f, "lr.w" },  // INST_LR_W
+    { 0xf800707f, 0x1800202f, "sc.w" },  // INST_SC_W
+    { 0xf800707f, 0x0800202f, "amoswap.w" },  // INST_AMOSWAP_W
+    { 0xf800707f, 0x0000202f, "amoadd.w" },  // INST_AMOADD_W
+    { 0xf800707f, 0x2000202f, "amoxor.w" },  // INST_AMOXOR_W
+    { 0xf800707f, 0x6000202f, "amoand.w" },  // INST_AMOAND_W
+    { 0xf800707f, 0x4000202f, "amoor.w" },  // INST_AMOOR_W
+    { 0xf800707f, 0x9000202f, "amomin.w" },  // INST_AMOMIN_W
+    { 0xf800707f, 0xa000202f, "amomax.w" },  // INST_AMOMAX_W
+    { 0xf800707f, 0xc000202f, "amominu.w" },  // INST_AMOMINU_W
+    { 0xf800707f, 0xe000202f, "amomaxu.w" },  // INST_AMOMAXU_W
+    { 0x0000707f, 0x00002007, "flw" },  // INST_FLW
+    { 0x0000707f, 0x00002027, "fsw" },  // INST_FSW
+    { 0x0600007f, 0x00000043, "fmadd.s" },  // INST_FMADD_S
+    { 0x0600007f, 0x00000047, "fmsub.s" },  // INST_FMSUB_S
+    { 0x0600007f, 0x0000004b, "fnmsub.s" },  // INST_FNMSUB_S
+    { 0x0600007f, 0x0000004f, "fnmadd.s" },  // INST_FNMADD_S
+    { 0xfe00007f, 0x00000053, "fadd.s" },  // INST_FADD_S
+    { 0xfe00007f, 0x08000053, "fsub.s" },  // INST_FSUB_S
+    { 0xfe00007f, 0x10000053, "fmul.s" },  // INST_FMUL_S
+    { 0xfe00007f, 0x18000053, "fdiv.s" },  // INST_FDIV_S
+    { 0xfff0007f, 0x58000053, "fsqrt.s" },  // INST_FSQRT_S
+    { 0xfe00707f, 0x20000053, "fsgnj.s" },  // INST_FSGNJ_S
+    { 0xfe00707f, 0x20001053, "fsgnjn.s" },  // INST_FSGNJN_S
+    { 0xfe00707f, 0x20002053, "fsgnjx.s" },  // INST_FSGNJX_S
+    { 0xfe00707f, 0x28000053, "fmin.s" },  // INST_FMIN_S
+    { 0xfe00707f, 0x28001053, "fmax.s" },  // INST_FMAX_S
+    { 0xfff0007f, 0xc0000053, "fcvt.w.s" },  // INST_FCVT_W_S
+    { 0xfff0007f, 0xc0100053, "fcvt.wu.s" },  // INST_FCVT_WU_S
+    { 0xfff0707f, 0xe0000053, "fmv.x.s" },  // INST_FMV_X_S
+    { 0xfe00707f, 0xa0002053, "feq.s" },  // INST_FEQ_S
+    { 0xfe00707f, 0xa0001053, "flt.s" },  // INST_FLT_S
+    { 0xfe00707f, 0xa0000053, "fle.s" },  // INST_FLE_S
+    { 0xfff0707f, 0xe0001053, "fclass.s" },  // INST_FCLASS_S
+    { 0xfff0007f, 0xd0000053, "fcvt.s.w" },  // INST_FCVT_S_W
+    { 0xfff0007f, 0xd0100053, "fcvt.s.wu" },  // INST_FCVT_S_WU
+    { 0xfff0707f, 0xf0000053, "fmv.s.x" },  // INST_FMV_S_X
+    { 0xfffff07f, 0x00302073, "frcsr" },  // INST_FRCSR
+    { 0xfffff07f, 0x00202073, "frrm" },  // INST_FRRM
+    { 0xfffff07f, 0x00102073, "frflags" },  // INST_FRFLAGS
+    { 0xfff0707f, 0x00301073, "fscsr" },  // INST_FSCSR
+    { 0xfff0707f, 0x00201073, "fsrm" },  // INST_FSRM
+    { 0xfff0707f, 0x00101073, "fsflags" },  // INST_FSFLAGS
+    { 0xfffff07f, 0x00205073, "fsrmi" },  // INST_FSRMI
+    { 0xfffff07f, 0x00105073, "fsflagsi" },  // INST_FSFLAGSI
+    { 0x0000707f, 0x00003007, "fld" },  // INST_FLD
+    { 0x0000707f, 0x00003027, "fsd" },  // INST_FSD
+    { 0x0600007f, 0x02000043, "fmadd.d" },  // INST_FMADD_D
+    { 0x0600007f, 0x02000047, "fmsub.d" },  // INST_FMSUB_D
+    { 0x0600007f, 0x0200004b, "fnmsub.d" },  // INST_FNMSUB_D
+    { 0x0600007f, 0x0200004f, "fnmadd.d" },  // INST_FNMADD_D
+    { 0xfe00007f, 0x02000053, "fadd.d" },  // INST_FADD_D
+    { 0xfe00007f, 0x0a000053, "fsub.d" },  // INST_FSUB_D
+    { 0xfe00007f, 0x12000053, "fmul.d" },  // INST_FMUL_D
+    { 0xfe00007f, 0x1a000053, "fdiv.d" },  // INST_FDIV_D
+    { 0xfff0007f, 0x5a000053, "fsqrt.d" },  // INST_FSQRT_D
+    { 0xfe00707f, 0x22000053, "fsgnj.d" },  // INST_FSGNJ_D
+    { 0xfe00707f, 0x22001053, "fsgnjn.d" },  // INST_FSGNJN_D
+    { 0xfe00707f, 0x22002053, "fsgnjx.d" },  // INST_FSGNJX_D
+    { 0xfe00707f, 0x2a000053, "fmin.d" },  // INST_FMIN_D
+    { 0xfe00707f, 0x2a001053, "fmax.d" },  // INST_FMAX_D
+    { 0xfff0007f, 0x40100053, "fcvt.s.d" },  // INST_FCVT_S_D
+    { 0xfff0007f, 0x42000053, "fcvt.d.s" },  // INST_FCVT_D_S
+    { 0xfe00707f, 0xa2002053, "feq.d" },  // INST_FEQ_D
+    { 0xfe00707f, 0xa2001053, "flt.d" },  // INST_FLT_D
+    { 0xfe00707f, 0xa2000053, "fle.d" },  // INST_FLE_D
+    { 0xfff0707f, 0xe2001053, "fclass.d" },  // INST_FCLASS_D
+    { 0xfff0007f, 0xc2000053, "fcvt.w.d" },  // INST_FCVT_W_D
+    { 0xfff0007f, 0xc2100053, "fcvt.wu.d" },  // INST_FCVT_WU_D
+    { 0xfff0007f, 0xd2000053, "fcvt.d.w" },  // INST_FCVT_D_W
+    { 0xfff0007f, 0xd2100053, "fcvt.d.wu" },  // INST_FCVT_D_WU
+};
@@ -25,107 +25,321 @@ n *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IM
  *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
-#include <math.h>
+#include <string.h>
 #include "./inst_operand.h"
+#include "./inst_decoder.h"
 #include "./inst_print.h"
 
-extern char *inst_strings [];
-extern operandList inst_operand[];
+/*!
+ * digit tables: two characters per entry
+ */
+static const char dec_pairs[200 + 1] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
 
-void PrintInst (uint32_t inst_hex, uint32_t inst_idx,
-                char *str_out, const uint32_t length,
-                riscvEnv env)
+static const char hex_pairs[512 + 1] =
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+
+/*!
+ * print lowest digits of value in hexadecimal, with leading zeros
+ * \return next position of buffer
+ */
+static inline char *FormatHex (char *p, uint32_t value, uint32_t digits)
 {
-    char *str_head = str_out;
-    char *inst_str = inst_strings[inst_idx];
-    uint32_t replace_idx = 0;
-    while (inst_str[0] != '\0') {
-        if (replace_idx > inst_operand[inst_idx].size) {
-            fprintf (stderr, "<Internal Error: instruction format index exceeded\n");
-            exit (EXIT_FAILURE);
-        }
-        if (inst_str[0] == '@') {
-            int i;
-            uint32_t msb_bit = inst_operand[inst_idx].msb_lst[replace_idx];
-            uint32_t lsb_bit = inst_operand[inst_idx].lsb_lst[replace_idx];
-            uint32_t type    = inst_operand[inst_idx].type_lst[replace_idx];
-            uint32_t length_field = msb_bit - lsb_bit + 1;
-            length_field = length_field % 4 == 0 ? (length_field / 4) : (length_field / 4 + 1);
-            uint32_t operand_bit =  ExtractBitField (inst_hex, msb_bit, lsb_bit);
-            uint8_t disp_array[8];
-            uint32_t divide_base;
-            switch (type) {
-            case operandTypeHex : divide_base = 16; break;
-            case operandTypeDec : divide_base = 10; break;
-            case operandTypeSB  : divide_base = 16; break;
-            case operandTypeUJ  : divide_base = 16; break;
-            }
-            for (i = 0; i < length_field; i++) {
-                disp_array[i] = operand_bit % divide_base;
-                operand_bit = operand_bit / divide_base;
-            }
-            switch (type) {
-            case operandTypeHex : sprintf (str_head, "0x"); str_head +=2; break;
-            case operandTypeDec : sprintf (str_head, "r");  str_head +=1; break;
-            case operandTypeSB  : sprintf (str_head, "0x"); str_head +=2; break;
-            case operandTypeUJ  : sprintf (str_head, "0x"); str_head +=2; break;
-            }
+    char *q = p + digits;
+    while (q - p >= 2) {
+        q -= 2;
+        memcpy (q, &hex_pairs[(value & 0xff) * 2], 2);
+        value >>= 8;
+    }
+    if (q != p) {
+        *p = hex_pairs[(value & 0x0f) * 2 + 1];
+    }
+    return p + digits;
+}
 
-            for (i = length_field - 1; i >= 0; i--) {
-                if (divide_base == 16) {
-                    str_head[0] = (disp_array[i] < 10) ? disp_array[i] + 0x30 : disp_array[i] + 0x57;
-                } else if (divide_base == 10) {
-                    str_head[0] = disp_array[i] + 0x30;
-                }
-                str_head ++;
-            }
-            replace_idx ++;
+
+/*!
+ * print lowest digits of value in decimal, with leading zeros
+ * \return next position of buffer
+ */
+static inline char *FormatDec (char *p, uint32_t value, uint32_t digits)
+{
+    char *q = p + digits;
+    while (q - p >= 2) {
+        q -= 2;
+        memcpy (q, &dec_pairs[(value % 100) * 2], 2);
+        value /= 100;
+    }
+    if (q != p) {
+        *p = '0' + value % 10;
+    }
+    return p + digits;
+}
+
+
+/*!
+ * print value in decimal, right aligned in width columns (as "%*llu")
+ * \return next position of buffer
+ */
+static char *FormatUDec (char *p, UDWord_t value, uint32_t width)
+{
+    char  digits[20];
+    char *q = digits + sizeof(digits);
+    while (value >= 100) {
+        q -= 2;
+        memcpy (q, &dec_pairs[(value % 100) * 2], 2);
+        value /= 100;
+    }
+    if (value >= 10) {
+        q -= 2;
+        memcpy (q, &dec_pairs[value * 2], 2);
+    } else {
+        *--q = '0' + value;
+    }
+    uint32_t length = digits + sizeof(digits) - q;
+    if (length < width) {
+        memset (p, ' ', width - length);
+        p += width - length;
+    }
+    memcpy (p, q, length);
+    return p + length;
+}
+
+
+/*!
+ * print raw instruction, compressed one is printed in 4 digits
+ * aligned to the right of 8 columns.
+ * \return next position of buffer
+ */
+static inline char *FormatInstHex (char *p, uint32_t inst_hex)
+{
+    if ((inst_hex & 0x03) != 0x03) {
+        memcpy (p, "    ", 4);
+        return FormatHex (p + 4, inst_hex, 4);
+    }
+    return FormatHex (p, inst_hex, 8);
+}
+
+
+/*!
+ * disassemble instruction by format program of generated table
+ * compressed instruction is printed as its 32-bit form.
+ * \param buf       output buffer, INST_PRINT_MAX characters at least
+ * \param inst_hex  instruction
+ * \param inst_idx  index of instruction
+ * \return length of string (not terminated)
+ */
+uint32_t FormatInst (char *buf, uint32_t inst_hex, uint32_t inst_idx)
+{
+    if ((inst_hex & 0x03) != 0x03) {
+        inst_hex = RISCV_EXPAND_RVC (inst_hex);
+    }
+
+    const printProgram *prog = &inst_print_prog[inst_idx];
+    const char *text = prog->text;
+    char *p = buf;
+    uint32_t i;
+
+    for (i = 0; i < prog->size; i++) {
+        const printStep *step = &prog->step[i];
+        memcpy (p, text, step->text_len);
+        p    += step->text_len;
+        text += step->text_len;
+        uint32_t value = (inst_hex >> step->lsb) & step->mask;
+        if (step->base == 10) {
+            p = FormatDec (p, value, step->digits);
         } else {
-            sprintf (str_head, "%c", inst_str[0]);
-            str_head++;
+            p = FormatHex (p, value, step->digits);
         }
-        inst_str++;
     }
-    str_head[0] = '\0'; str_head ++;
+    memcpy (p, text, prog->tail_len);
+    p += prog->tail_len;
+
+    return p - buf;
+}
+
+
+void PrintInst (uint32_t inst_hex, uint32_t inst_idx,
+                char *str_out, const uint32_t length,
+                riscvEnv env)
+{
+    char buf[INST_PRINT_MAX];
+    uint32_t size = FormatInst (buf, inst_hex, inst_idx);
+    if (size > length) {
+        size = length;
+    }
+    memcpy (str_out, buf, size);
+    str_out[size] = '\0';
 }
 
 
 void PrintOperand (riscvEnv env)
 {
+    PrintTraceInfo (env->dbgfp, env->trace);
+}
+
+
+/*!
+ * format behavior of instruction
+ * \param buf    output buffer, TRACE_PRINT_MAX characters at least
+ * \param trace  trace of instruction
+ * \return length of string (not terminated)
+ */
+uint32_t FormatTraceInfo (char *buf, traceInfo trace)
+{
+    char *p = buf;
     uint32_t trace_count;
-    for (trace_count = 0; trace_count < env->trace->max; trace_count ++) {
-        switch (env->trace->trace_type[trace_count]) {
+    for (trace_count = 0; trace_count < trace->max; trace_count ++) {
+        Addr_t addr  = trace->trace_addr[trace_count];
+        Word_t value = trace->trace_value[trace_count];
+        switch (trace->trace_type[trace_count]) {
         case trace_regwrite :
-            if (env->trace->trace_addr[trace_count] == REG_PC) {
-                fprintf (env->dbgfp, "pc<=%08x ",
-                         env->trace->trace_value[trace_count]);
+            if (addr == REG_PC) {
+                memcpy (p, "pc<=", 4); p += 4;
             } else {
-                fprintf (env->dbgfp, "r%02d<=%08x ",
-                         env->trace->trace_addr[trace_count],
-                         env->trace->trace_value[trace_count]);
+                *p++ = 'r';
+                p = (addr < 100) ? FormatDec (p, addr, 2) : FormatUDec (p, addr, 0);
+                memcpy (p, "<=", 2); p += 2;
             }
+            p = FormatHex (p, value, 8);
+            *p++ = ' ';
             break;
-#ifdef NEVER
-        case trace_regread :
-            fprintf (env->dbgfp, "r%02d=>%08x ",
-                     env->trace->trace_addr[trace_count],
-                     env->trace->trace_value[trace_count]);
-            break;
-#endif // NEVER
         case trace_memwrite :
-            fprintf (env->dbgfp, "(%08x)<=%08x ",
-                     env->trace->trace_addr[trace_count],
-                     env->trace->trace_value[trace_count]);
+            *p++ = '(';
+            p = FormatHex (p, addr, 8);
+            memcpy (p, ")<=", 3); p += 3;
+            p = FormatHex (p, value, 8);
+            *p++ = ' ';
             break;
-#ifdef NEVER
-        case trace_memread :
-            fprintf (env->dbgfp, "(%08x)=>%08x ",
-                     env->trace->trace_addr[trace_count],
-                     env->trace->trace_value[trace_count]);
+        default :
+            /* register / memory read is not printed */
             break;
-#endif // NEVER
         }
     }
+    return p - buf;
+}
+
+
+/*!
+ * print behavior of instruction
+ * \param fp     file pointer to be printed
+ * \param trace  trace of instruction
+ */
+void PrintTraceInfo (FILE *fp, traceInfo trace)
+{
+    char buf[TRACE_PRINT_MAX];
+    fwrite (buf, 1, FormatTraceInfo (buf, trace), fp);
+}
+
+
+/*!
+ * format one line of instruction log, same as PrintStepLog
+ * \param buf       output buffer, STEP_LOG_MAX characters at least
+ * \param step      step number
+ * \param pc        PC of instruction
+ * \param inst_hex  instruction
+ * \param inst_idx  index of instruction, -1 if not decoded
+ * \param trace     trace of instruction
+ * \return length of line including '\n' (not terminated)
+ */
+uint32_t FormatStepLog (char *buf, UDWord_t step, Addr_t pc,
+                        Word_t inst_hex, uint32_t inst_idx, traceInfo trace)
+{
+    char *p = buf;
+
+    if (inst_idx == -1) {
+        static const char error_head[] = "<Error: instruction is not decoded. [";
+        memcpy (p, error_head, sizeof(error_head) - 1); p += sizeof(error_head) - 1;
+        p = FormatHex (p, pc, 8);
+        memcpy (p, "]=", 2); p += 2;
+        p = FormatHex (p, inst_hex, 8);
+        *p++ = '\n';
+        return p - buf;
+    }
+
+    p = FormatUDec (p, step, 10);
+    memcpy (p, " : [", 4); p += 4;
+    p = FormatHex (p, pc, 8);
+    *p++ = ']';
+    *p++ = ' ';
+    p = FormatInstHex (p, inst_hex);
+    memcpy (p, " : ", 3); p += 3;
+
+    /* mnemonic is padded to 30 columns, then 2 spaces */
+    uint32_t length = FormatInst (p, inst_hex, inst_idx);
+    if (length < 30) {
+        memset (p + length, ' ', 30 - length);
+        length = 30;
+    }
+    p += length;
+    memcpy (p, "  ", 2); p += 2;
+
+    p += FormatTraceInfo (p, trace);
+    *p++ = '\n';
+
+    return p - buf;
+}
+
+
+/*!
+ * format one line of disassembly listing, "[pc] inst_hex : mnemonic"
+ * \param buf       output buffer, DISASM_LINE_MAX characters at least
+ * \param pc        address of instruction
+ * \param inst_hex  instruction
+ * \param inst_idx  index of instruction, -1 if not decoded
+ * \return length of line including '\n' (not terminated)
+ */
+uint32_t FormatDisasmLine (char *buf, Addr_t pc, Word_t inst_hex, uint32_t inst_idx)
+{
+    char *p = buf;
+
+    *p++ = '[';
+    p = FormatHex (p, pc, 8);
+    *p++ = ']';
+    *p++ = ' ';
+    p = FormatInstHex (p, inst_hex);
+    memcpy (p, " : ", 3); p += 3;
+    if (inst_idx == -1 && (inst_hex & 0x03) != 0x03) {
+        memcpy (p, ".hword     0x", 13); p += 13;
+        p = FormatHex (p, inst_hex, 4);
+    } else if (inst_idx == -1) {
+        memcpy (p, ".word      0x", 13); p += 13;
+        p = FormatHex (p, inst_hex, 8);
+    } else {
+        p += FormatInst (p, inst_hex, inst_idx);
+    }
+    *p++ = '\n';
+
+    return p - buf;
+}
+
+
+/*!
+ * print one line of instruction log
+ * \param fp        file pointer to be printed
+ * \param step      step number
+ * \param pc        PC of instruction
+ * \param inst_hex  instruction
+ * \param inst_idx  index of instruction, -1 if not decoded
+ * \param trace     trace of instruction
+ */
+void PrintStepLog (FILE *fp, UDWord_t step, Addr_t pc,
+                   Word_t inst_hex, uint32_t inst_idx, traceInfo trace)
+{
+    char buf[STEP_LOG_MAX];
+    fwrite (buf, 1, FormatStepLog (buf, step, pc, inst_hex, inst_idx, trace), fp);
 }
@@ -28,7 +28,30 @@
 #pragma once
 
 
+#include <stdio.h>
 #include <stdint.h>
+#include "./env.h"
+#include "./trace.h"
+#include "./inst_operand.h"
+
+/*!
+ * buffer size for Format functions
+ */
+#define INST_PRINT_MAX   (INST_PRINT_TEXT_SIZE + MAX_OPERANDS * 8)
+#define TRACE_PRINT_MAX  (TRACE_MAX * 22)
+#define STEP_LOG_MAX     (64 + INST_PRINT_MAX + TRACE_PRINT_MAX)
+#define DISASM_LINE_MAX  (32 + INST_PRINT_MAX)
+
+uint32_t FormatInst (char *buf, uint32_t inst_hex, uint32_t inst_idx);
+uint32_t FormatTraceInfo (char *buf, traceInfo trace);
+uint32_t FormatStepLog (char *buf, UDWord_t step, Addr_t pc,
+                        Word_t inst_hex, uint32_t inst_idx, traceInfo trace);
+uint32_t FormatDisasmLine (char *buf, Addr_t pc, Word_t inst_hex, uint32_t inst_idx);
+
 void PrintInst (uint32_t inst_hex, uint32_t inst_idx,
                 char *str_out, const uint32_t length,
                 riscvEnv env);
+void PrintOperand (riscvEnv env);
+void PrintTraceInfo (FILE *fp, traceInfo trace);
+void PrintStepLog (FILE *fp, UDWord_t step, Addr_t pc,
+                   Word_t inst_hex, uint32_t inst_idx, traceInfo trace);
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* CAUTION! THIS SOURCE CODE IS GENERATED AUTOMATICALLY. DON'T MODIFY BY HAND. */
+
+
+#pragma once
+
+
+#include <stdint.h>
+#include "./env.h"
+#include "./inst_list.h"
+#include "./dec_utils.h"
+#include "./inst_format.h"
+
+
+void RISCV_INST_LUI (const instOperands *op, riscvEnv env);
+void RISCV_INST_AUIPC (const instOperands *op, riscvEnv env);
+void RISCV_INST_JAL (const instOperands *op, riscvEnv env);
+void RISCV_INST_JALR (const instOperands *op, riscvEnv env);
+void RISCV_INST_BEQ (const instOperands *op, riscvEnv env);
+void RISCV_INST_BNE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BLT (const instOperands *op, riscvEnv env);
+void RISCV_INST_BGE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BLTU (const instOperands *op, riscvEnv env);
+void RISCV_INST_BGEU (const instOperands *op, riscvEnv env);
+void RISCV_INST_LB (const instOperands *op, riscvEnv env);
+void RISCV_INST_LH (const instOperands *op, riscvEnv env);
+void RISCV_INST_LW (const instOperands *op, riscvEnv env);
+void RISCV_INST_LBU (const instOperands *op, riscvEnv env);
+void RISCV_INST_LHU (const instOperands *op, riscvEnv env);
+void RISCV_INST_SB (const instOperands *op, riscvEnv env);
+void RISCV_INST_SH (const instOperands *op, riscvEnv env);
+void RISCV_INST_SW (const instOperands *op, riscvEnv env);
+void RISCV_INST_ADDI (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLTI (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLTIU (const instOperands *op, riscvEnv env);
+void RISCV_INST_XORI (const instOperands *op, riscvEnv env);
+void RISCV_INST_ORI (const instOperands *op, riscvEnv env);
+void RISCV_INST_ANDI (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLLI (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRLI (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRAI (const instOperands *op, riscvEnv env);
+void RISCV_INST_ADD (const instOperands *op, riscvEnv env);
+void RISCV_INST_SUB (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLL (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLT (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLTU (const instOperands *op, riscvEnv env);
+void RISCV_INST_XOR (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRL (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRA (const instOperands *op, riscvEnv env);
+void RISCV_INST_OR (const instOperands *op, riscvEnv env);
+void RISCV_INST_AND (const instOperands *op, riscvEnv env);
+void RISCV_INST_FENCE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FENCE_I (const instOperands *op, riscvEnv env);
+void RISCV_INST_SCALL (const instOperands *op, riscvEnv env);
+void RISCV_INST_SBREAK (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDCYCLE (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDCYCLEH (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDTIME (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDTIMEH (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDINSTRET (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDINSTRETH (const instOperands *op, riscvEnv env);
+void RISCV_INST_MUL (const instOperands *op, riscvEnv env);
+void RISCV_INST_MULH (const instOperands *op, riscvEnv env);
+void RISCV_INST_MULHSU (const instOperands *op, riscvEnv env);
+void RISCV_INST_MULHU (const instOperands *op, riscvEnv env);
+void RISCV_INST_DIV (const instOperands *op, riscvEnv env);
+void RISCV_INST_DIVU (const instOperands *op, riscvEnv env);
+void RISCV_INST_REM (const instOperands *op, riscvEnv env);
+void RISCV_INST_REMU (const instOperands *op, riscvEnv env);
+void RISCV_INST_LR_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_SC_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOSWAP_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOADD_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOXOR_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOAND_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOOR_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMIN_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMAX_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMINU_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMAXU_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLW (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSW (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMADD_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMSUB_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMSUB_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMADD_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FADD_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSUB_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMUL_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FDIV_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSQRT_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJ_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJN_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJX_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMIN_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMAX_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_W_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_WU_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMV_X_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FEQ_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLT_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLE_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCLASS_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_S_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_S_WU (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMV_S_X (const instOperands *op, riscvEnv env);
+void RISCV_INST_FRCSR (const instOperands *op, riscvEnv env);
+void RISCV_INST_FRRM (const instOperands *op, riscvEnv env);
+void RISCV_INST_FRFLAGS (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSCSR (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSRM (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSFLAGS (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSRMI (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSFLAGSI (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLD (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSD (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMADD_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMSUB_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMSUB_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMADD_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FADD_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSUB_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMUL_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FDIV_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSQRT_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJ_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJN_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJX_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMIN_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMAX_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_S_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_D_S (const instOperands *op, riscvEnv env);
+void RISCV_INST_FEQ_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLT_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLE_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCLASS_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_W_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_WU_D (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_D_W (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_D_WU (const instOperands *op, riscvEnv env);
+
+void RISCV_INST_LUI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AUIPC_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_JAL_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_JALR_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BEQ_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BNE_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BLT_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BGE_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BLTU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_BGEU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_LB_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_LH_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_LW_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_LBU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_LHU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SB_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SH_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SW_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_ADDI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLTI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLTIU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_XORI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_ORI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_ANDI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLLI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRLI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRAI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_ADD_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SUB_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLL_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLT_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SLTU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_XOR_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRL_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SRA_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_OR_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AND_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FENCE_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FENCE_I_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SCALL_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SBREAK_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDCYCLE_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDCYCLEH_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDTIME_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDTIMEH_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDINSTRET_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_RDINSTRETH_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_MUL_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_MULH_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_MULHSU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_MULHU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_DIV_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_DIVU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_REM_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_REMU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_LR_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_SC_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOSWAP_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOADD_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOXOR_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOAND_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOOR_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMIN_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMAX_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMINU_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_AMOMAXU_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLW_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSW_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMADD_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMSUB_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMSUB_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMADD_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FADD_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSUB_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMUL_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FDIV_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSQRT_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJ_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJN_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJX_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMIN_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMAX_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_W_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_WU_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMV_X_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FEQ_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLT_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLE_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCLASS_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_S_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_S_WU_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMV_S_X_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FRCSR_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FRRM_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FRFLAGS_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSCSR_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSRM_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSFLAGS_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSRMI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSFLAGSI_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLD_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSD_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMADD_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMSUB_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMSUB_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FNMADD_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FADD_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSUB_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMUL_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FDIV_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSQRT_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJ_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJN_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FSGNJX_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMIN_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FMAX_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_S_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_D_S_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FEQ_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLT_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FLE_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCLASS_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_W_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_WU_D_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_D_W_NOTRACE (const instOperands *op, riscvEnv env);
+void RISCV_INST_FCVT_D_WU_NOTRACE (const instOperands *op, riscvEnv env);
+
+
+#ifdef SIM_NOTRACE
+#define RISCV_INST_LUI RISCV_INST_LUI_NOTRACE
+#define RISCV_INST_AUIPC RISCV_INST_AUIPC_NOTRACE
+#define RISCV_INST_JAL RISCV_INST_JAL_NOTRACE
+#define RISCV_INST_JALR RISCV_INST_JALR_NOTRACE
+#define RISCV_INST_BEQ RISCV_INST_BEQ_NOTRACE
+#define RISCV_INST_BNE RISCV_INST_BNE_NOTRACE
+#define RISCV_INST_BLT RISCV_INST_BLT_NOTRACE
+#define RISCV_INST_BGE RISCV_INST_BGE_NOTRACE
+#define RISCV_INST_BLTU RISCV_INST_BLTU_NOTRACE
+#define RISCV_INST_BGEU RISCV_INST_BGEU_NOTRACE
+#define RISCV_INST_LB RISCV_INST_LB_NOTRACE
+#define RISCV_INST_LH RISCV_INST_LH_NOTRACE
+#define RISCV_INST_LW RISCV_INST_LW_NOTRACE
+#define RISCV_INST_LBU RISCV_INST_LBU_NOTRACE
+#define RISCV_INST_LHU RISCV_INST_LHU_NOTRACE
+#define RISCV_INST_SB RISCV_INST_SB_NOTRACE
+#define RISCV_INST_SH RISCV_INST_SH_NOTRACE
+#define RISCV_INST_SW RISCV_INST_SW_NOTRACE
+#define RISCV_INST_ADDI RISCV_INST_ADDI_NOTRACE
+#define RISCV_INST_SLTI RISCV_INST_SLTI_NOTRACE
+#define RISCV_INST_SLTIU RISCV_INST_SLTIU_NOTRACE
+#define RISCV_INST_XORI RISCV_INST_XORI_NOTRACE
+#define RISCV_INST_ORI RISCV_INST_ORI_NOTRACE
+#define RISCV_INST_ANDI RISCV_INST_ANDI_NOTRACE
+#define RISCV_INST_SLLI RISCV_INST_SLLI_NOTRACE
+#define RISCV_INST_SRLI RISCV_INST_SRLI_NOTRACE
+#define RISCV_INST_SRAI RISCV_INST_SRAI_NOTRACE
+#define RISCV_INST_ADD RISCV_INST_ADD_NOTRACE
+#define RISCV_INST_SUB RISCV_INST_SUB_NOTRACE
+#define RISCV_INST_SLL RISCV_INST_SLL_NOTRACE
+#define RISCV_INST_SLT RISCV_INST_SLT_NOTRACE
+#define RISCV_INST_SLTU RISCV_INST_SLTU_NOTRACE
+#define RISCV_INST_XOR RISCV_INST_XOR_NOTRACE
+#define RISCV_INST_SRL RISCV_INST_SRL_NOTRACE
+#define RISCV_INST_SRA RISCV_INST_SRA_NOTRACE
+#define RISCV_INST_OR RISCV_INST_OR_NOTRACE
+#define RISCV_INST_AND RISCV_INST_AND_NOTRACE
+#define RISCV_INST_FENCE RISCV_INST_FENCE_NOTRACE
+#define RISCV_INST_FENCE_I RISCV_INST_FENCE_I_NOTRACE
+#define RISCV_INST_SCALL RISCV_INST_SCALL_NOTRACE
+#define RISCV_INST_SBREAK RISCV_INST_SBREAK_NOTRACE
+#define RISCV_INST_RDCYCLE RISCV_INST_RDCYCLE_NOTRACE
+#define RISCV_INST_RDCYCLEH RISCV_INST_RDCYCLEH_NOTRACE
+#define RISCV_INST_RDTIME RISCV_INST_RDTIME_NOTRACE
+#define RISCV_INST_RDTIMEH RISCV_INST_RDTIMEH_NOTRACE
+#define RISCV_INST_RDINSTRET RISCV_INST_RDINSTRET_NOTRACE
+#define RISCV_INST_RDINSTRETH RISCV_INST_RDINSTRETH_NOTRACE
+#define RISCV_INST_MUL RISCV_INST_MUL_NOTRACE
+#define RISCV_INST_MULH RISCV_INST_MULH_NOTRACE
+#define RISCV_INST_MULHSU RISCV_INST_MULHSU_NOTRACE
+#define RISCV_INST_MULHU RISCV_INST_MULHU_NOTRACE
+#define RISCV_INST_DIV RISCV_INST_DIV_NOTRACE
+#define RISCV_INST_DIVU RISCV_INST_DIVU_NOTRACE
+#define RISCV_INST_REM RISCV_INST_REM_NOTRACE
+#define RISCV_INST_REMU RISCV_INST_REMU_NOTRACE
+#define RISCV_INST_LR_W RISCV_INST_LR_W_NOTRACE
+#define RISCV_INST_SC_W RISCV_INST_SC_W_NOTRACE
+#define RISCV_INST_AMOSWAP_W RISCV_INST_AMOSWAP_W_NOTRACE
+#define RISCV_INST_AMOADD_W RISCV_INST_AMOADD_W_NOTRACE
+#define RISCV_INST_AMOXOR_W RISCV_INST_AMOXOR_W_NOTRACE
+#define RISCV_INST_AMOAND_W RISCV_INST_AMOAND_W_NOTRACE
+#define RISCV_INST_AMOOR_W RISCV_INST_AMOOR_W_NOTRACE
+#define RISCV_INST_AMOMIN_W RISCV_INST_AMOMIN_W_NOTRACE
+#define RISCV_INST_AMOMAX_W RISCV_INST_AMOMAX_W_NOTRACE
+#define RISCV_INST_AMOMINU_W RISCV_INST_AMOMINU_W_NOTRACE
+#define RISCV_INST_AMOMAXU_W RISCV_INST_AMOMAXU_W_NOTRACE
+#define RISCV_INST_FLW RISCV_INST_FLW_NOTRACE
+#define RISCV_INST_FSW RISCV_INST_FSW_NOTRACE
+#define RISCV_INST_FMADD_S RISCV_INST_FMADD_S_NOTRACE
+#define RISCV_INST_FMSUB_S RISCV_INST_FMSUB_S_NOTRACE
+#define RISCV_INST_FNMSUB_S RISCV_INST_FNMSUB_S_NOTRACE
+#define RISCV_INST_FNMADD_S RISCV_INST_FNMADD_S_NOTRACE
+#define RISCV_INST_FADD_S RISCV_INST_FADD_S_NOTRACE
+#define RISCV_INST_FSUB_S RISCV_INST_FSUB_S_NOTRACE
+#define RISCV_INST_FMUL_S RISCV_INST_FMUL_S_NOTRACE
+#define RISCV_INST_FDIV_S RISCV_INST_FDIV_S_NOTRACE
+#define RISCV_INST_FSQRT_S RISCV_INST_FSQRT_S_NOTRACE
+#define RISCV_INST_FSGNJ_S RISCV_INST_FSGNJ_S_NOTRACE
+#define RISCV_INST_FSGNJN_S RISCV_INST_FSGNJN_S_NOTRACE
+#define RISCV_INST_FSGNJX_S RISCV_INST_FSGNJX_S_NOTRACE
+#define RISCV_INST_FMIN_S RISCV_INST_FMIN_S_NOTRACE
+#define RISCV_INST_FMAX_S RISCV_INST_FMAX_S_NOTRACE
+#define RISCV_INST_FCVT_W_S RISCV_INST_FCVT_W_S_NOTRACE
+#define RISCV_INST_FCVT_WU_S RISCV_INST_FCVT_WU_S_NOTRACE
+#define RISCV_INST_FMV_X_S RISCV_INST_FMV_X_S_NOTRACE
+#define RISCV_INST_FEQ_S RISCV_INST_FEQ_S_NOTRACE
+#define RISCV_INST_FLT_S RISCV_INST_FLT_S_NOTRACE
+#define RISCV_INST_FLE_S RISCV_INST_FLE_S_NOTRACE
+#define RISCV_INST_FCLASS_S RISCV_INST_FCLASS_S_NOTRACE
+#define RISCV_INST_FCVT_S_W RISCV_INST_FCVT_S_W_NOTRACE
+#define RISCV_INST_FCVT_S_WU RISCV_INST_FCVT_S_WU_NOTRACE
+#define RISCV_INST_FMV_S_X RISCV_INST_FMV_S_X_NOTRACE
+#define RISCV_INST_FRCSR RISCV_INST_FRCSR_NOTRACE
+#define RISCV_INST_FRRM RISCV_INST_FRRM_NOTRACE
+#define RISCV_INST_FRFLAGS RISCV_INST_FRFLAGS_NOTRACE
+#define RISCV_INST_FSCSR RISCV_INST_FSCSR_NOTRACE
+#define RISCV_INST_FSRM RISCV_INST_FSRM_NOTRACE
+#define RISCV_INST_FSFLAGS RISCV_INST_FSFLAGS_NOTRACE
+#define RISCV_INST_FSRMI RISCV_INST_FSRMI_NOTRACE
+#define RISCV_INST_FSFLAGSI RISCV_INST_FSFLAGSI_NOTRACE
+#define RISCV_INST_FLD RISCV_INST_FLD_NOTRACE
+#define RISCV_INST_FSD RISCV_INST_FSD_NOTRACE
+#define RISCV_INST_FMADD_D RISCV_INST_FMADD_D_NOTRACE
+#define RISCV_INST_FMSUB_D RISCV_INST_FMSUB_D_NOTRACE
+#define RISCV_INST_FNMSUB_D RISCV_INST_FNMSUB_D_NOTRACE
+#define RISCV_INST_FNMADD_D RISCV_INST_FNMADD_D_NOTRACE
+#define RISCV_INST_FADD_D RISCV_INST_FADD_D_NOTRACE
+#define RISCV_INST_FSUB_D RISCV_INST_FSUB_D_NOTRACE
+#define RISCV_INST_FMUL_D RISCV_INST_FMUL_D_NOTRACE
+#define RISCV_INST_FDIV_D RISCV_INST_FDIV_D_NOTRACE
+#define RISCV_INST_FSQRT_D RISCV_INST_FSQRT_D_NOTRACE
+#define RISCV_INST_FSGNJ_D RISCV_INST_FSGNJ_D_NOTRACE
+#define RISCV_INST_FSGNJN_D RISCV_INST_FSGNJN_D_NOTRACE
+#define RISCV_INST_FSGNJX_D RISCV_INST_FSGNJX_D_NOTRACE
+#define RISCV_INST_FMIN_D RISCV_INST_FMIN_D_NOTRACE
+#define RISCV_INST_FMAX_D RISCV_INST_FMAX_D_NOTRACE
+#define RISCV_INST_FCVT_S_D RISCV_INST_FCVT_S_D_NOTRACE
+#define RISCV_INST_FCVT_D_S RISCV_INST_FCVT_D_S_NOTRACE
+#define RISCV_INST_FEQ_D RISCV_INST_FEQ_D_NOTRACE
+#define RISCV_INST_FLT_D RISCV_INST_FLT_D_NOTRACE
+#define RISCV_INST_FLE_D RISCV_INST_FLE_D_NOTRACE
+#define RISCV_INST_FCLASS_D RISCV_INST_FCLASS_D_NOTRACE
+#define RISCV_INST_FCVT_W_D RISCV_INST_FCVT_W_D_NOTRACE
+#define RISCV_INST_FCVT_WU_D RISCV_INST_FCVT_WU_D_NOTRACE
+#define RISCV_INST_FCVT_D_W RISCV_INST_FCVT_D_W_NOTRACE
+#define RISCV_INST_FCVT_D_WU RISCV_INST_FCVT_D_WU_NOTRACE
+#endif  // SIM_NOTRACE
@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "./env.h"
+#include "./block.h"
+#include "./jit.h"
+#include "./inst_list.h"
+
+#if !defined(__x86_64__)
+#error "JIT supports only x86-64 host"
+#endif
+
+/* host registers */
+#define EAX  0
+#define ECX  1
+#define EDX  2
+#define EBX  3
+#define ESI  6
+#define EDI  7
+
+/* condition codes of Jcc/SETcc/CMOVcc */
+#define CC_B   0x2
+#define CC_AE  0x3
+#define CC_E   0x4
+#define CC_NE  0x5
+#define CC_L   0xc
+#define CC_GE  0xd
+
+#define ENV_REG_OFFSET(r)  ((uint32_t)(offsetof (struct __riscvEnv, regs) + (r) * sizeof (Word_t)))
+#define ENV_PC_OFFSET      ((uint32_t)offsetof (struct __riscvEnv, pc))
+#define ENV_CUR_PC_OFFSET  ((uint32_t)offsetof (struct __riscvEnv, current_pc))
+#define ENV_STEP_OFFSET    ((uint32_t)offsetof (struct __riscvEnv, step))
+#define ENV_STOP_OFFSET    ((uint32_t)offsetof (struct __riscvEnv, stop_reason))
+
+typedef struct {
+    Byte_t *p;
+} jitEmitter;
+
+static inline void Emit8  (jitEmitter *e, uint8_t v)  { *e->p++ = v; }
+static inline void Emit32 (jitEmitter *e, uint32_t v) { memcpy (e->p, &v, 4); e->p += 4; }
+static inline void Emit64 (jitEmitter *e, uint64_t v) { memcpy (e->p, &v, 8); e->p += 8; }
+
+static bool IsTranslatable (uint32_t);
+static void EmitInst (jitEmitter *, const blockInst *, uint32_t);
+
+
+/*!
+ * create executable code cache
+ */
+jitCache CreateJITCache (void)
+{
+    jitCache jc = (jitCache) checked_malloc (sizeof (*jc));
+    memset (jc, 0, sizeof (*jc));
+
+    void *code = mmap (NULL, JIT_CACHE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED) {
+        perror ("mmap");
+        exit (EXIT_FAILURE);
+    }
+    jc->code = (Byte_t *)code;
+    return jc;
+}
+
+
+/*!
+ * release JIT cache
+ * \param jc  JIT cache, may be NULL
+ */
+void DestroyJITCache (jitCache jc)
+{
+    if (jc == NULL) {
+        return;
+    }
+    munmap (jc->code, JIT_CACHE_SIZE);
+    free (jc);
+}
+
+
+/*!
+ * throw away all translated code.
+ * called from FlushBlockCache, since blocks keep pointers to the code.
+ * \param env  RISC-V environment
+ */
+void FlushJITCache (riscvEnv env)
+{
+    jitCache jc = env->jit_cache;
+    if (jc == NULL) {
+        return;
+    }
+    jc->used = 0;
+    jc->flushes++;
+}
+
+
+/*!
+ * translate basic block into host code
+ * \param blk  block to be translated
+ * \param env  RISC-V environment
+ * \return     true if translated, false if block is left to interpreter
+ */
+bool TranslateBlock (block blk, riscvEnv env)
+{
+    jitCache jc = env->jit_cache;
+
+    uint32_t i;
+    for (i = 0; i < blk->len; i++) {
+        if (IsTranslatable (blk->insts[i].inst_idx) == false) {
+            jc->rejected++;
+            return false;
+        }
+    }
+    if (jc->used + JIT_BLOCK_MAX_CODE > JIT_CACHE_SIZE) {
+        /* other blocks refer the code, so all blocks are thrown away */
+        FlushBlockCache (env);
+        return false;
+    }
+
+    jitEmitter e = { jc->code + jc->used };
+    Byte_t *entry = e.p;
+
+    Emit8 (&e, 0x53);                               // push rbx
+    Emit8 (&e, 0x48); Emit8 (&e, 0x89); Emit8 (&e, 0xfb);  // mov rbx, rdi
+
+    for (i = 0; i < blk->len; i++) {
+        EmitInst (&e, &blk->insts[i], blk->len - i - 1);
+    }
+    if (IsBlockTerminator (blk->insts[blk->len - 1].inst_idx) == false) {
+        /* block is cut, continue from next instruction */
+        Emit8 (&e, 0xc7); Emit8 (&e, 0x83);         // mov dword [rbx + pc], imm32
+        Emit32 (&e, ENV_PC_OFFSET);
+        Emit32 (&e, blk->insts[blk->len].pc);
+    }
+
+    Emit8 (&e, 0x5b);                               // pop rbx
+    Emit8 (&e, 0xc3);                               // ret
+
+    jc->used = (e.p - jc->code + 15) & ~(size_t)15;
+    jc->translated++;
+    blk->jit_code = entry;
+    return true;
+}
+
+
+/*!
+ * instructions which are not translated.
+ * FPU, AMO and instructions which need interpreter for control flow.
+ */
+static bool IsTranslatable (uint32_t inst_idx)
+{
+    if (inst_idx >= INST_LR_W) {
+        return false;
+    }
+    switch (inst_idx) {
+    case INST_FENCE_I :
+    case INST_SCALL :
+    case INST_SBREAK :
+        return false;
+    default :
+        return true;
+    }
+}
+
+
+/* mov r32, [rbx + disp32] / xor r32, r32 for r0 */
+static void EmitLoadGReg (jitEmitter *e, int host, RegAddr_t reg)
+{
+    if (reg == 0) {
+        Emit8 (e, 0x31); Emit8 (e, 0xc0 | (host << 3) | host);
+    } else {
+        Emit8 (e, 0x8b); Emit8 (e, 0x80 | (host << 3) | EBX);
+        Emit32 (e, ENV_REG_OFFSET (reg));
+    }
+}
+
+
+/* mov [rbx + disp32], r32, write to r0 is discarded */
+static void EmitStoreGReg (jitEmitter *e, RegAddr_t reg, int host)
+{
+    if (reg != 0) {
+        Emit8 (e, 0x89); Emit8 (e, 0x80 | (host << 3) | EBX);
+        Emit32 (e, ENV_REG_OFFSET (reg));
+    }
+}
+
+
+/* mov r32, imm32 */
+static void EmitMovImm (jitEmitter *e, int host, uint32_t imm)
+{
+    Emit8 (e, 0xb8 + host);
+    Emit32 (e, imm);
+}
+
+
+/* mov r64, imm64 */
+static void EmitMovImm64 (jitEmitter *e, int host, uint64_t imm)
+{
+    Emit8 (e, 0x48); Emit8 (e, 0xb8 + host);
+    Emit64 (e, imm);
+}
+
+
+/* mov dword [rbx + disp32], imm32 */
+static void EmitStoreEnvImm (jitEmitter *e, uint32_t offset, uint32_t imm)
+{
+    Emit8 (e, 0xc7); Emit8 (e, 0x83);
+    Emit32 (e, offset);
+    Emit32 (e, imm);
+}
+
+
+/* mov rax, func ; call rax */
+static void EmitCall (jitEmitter *e, const void *func)
+{
+    Emit8 (e, 0x48); Emit8 (e, 0xb8);
+    Emit64 (e, (uint64_t)(uintptr_t)func);
+    Emit8 (e, 0xff); Emit8 (e, 0xd0);
+}
+
+
+/* eax = eax <op> imm32 */
+static void EmitAluImm (jitEmitter *e, uint8_t opcode, uint32_t imm)
+{
+    Emit8 (e, opcode);
+    Emit32 (e, imm);
+}
+
+
+/* eax = eax <op> ecx */
+static void EmitAluReg (jitEmitter *e, uint8_t opcode)
+{
+    Emit8 (e, opcode); Emit8 (e, 0xc8);
+}
+
+
+/* eax = (eax <cc> ecx) ? 1 : 0 */
+static void EmitSetCC (jitEmitter *e, uint8_t cc)
+{
+    Emit8 (e, 0x39); Emit8 (e, 0xc8);                   // cmp eax, ecx
+    Emit8 (e, 0x0f); Emit8 (e, 0x90 | cc); Emit8 (e, 0xc0);  // setcc al
+    Emit8 (e, 0x0f); Emit8 (e, 0xb6); Emit8 (e, 0xc0);  // movzx eax, al
+}
+
+
+/* LoadMemoryNoTrace (eax + imm, size, env) into eax */
+static void EmitLoadMemory (jitEmitter *e, const blockInst *ip, Size_t size)
+{
+    EmitLoadGReg (e, EAX, ip->rs1);
+    EmitAluImm (e, 0x05, ip->imm);                      // add eax, imm32
+    Emit8 (e, 0x89); Emit8 (e, 0xc7);                   // mov edi, eax
+    EmitMovImm (e, ESI, size);
+    Emit8 (e, 0x48); Emit8 (e, 0x89); Emit8 (e, 0xda);  // mov rdx, rbx
+    EmitCall (e, (const void *)LoadMemoryNoTrace);
+}
+
+
+/*!
+ * leave block after handler if it requested stop, as interpreter does.
+ * steps of remaining instructions were counted in advance, so they are taken back.
+ */
+static void EmitStopCheck (jitEmitter *e, const blockInst *ip, uint32_t remaining)
+{
+    Emit8 (e, 0x83); Emit8 (e, 0xbb);                   // cmp dword [rbx + stop_reason], 0
+    Emit32 (e, ENV_STOP_OFFSET);
+    Emit8 (e, 0x00);
+    Emit8 (e, 0x74); Emit8 (e, 23);                     // jz over following 23 bytes
+    EmitStoreEnvImm (e, ENV_PC_OFFSET, ip->next_pc);
+    Emit8 (e, 0x48); Emit8 (e, 0x81); Emit8 (e, 0xab);  // sub qword [rbx + step], imm32
+    Emit32 (e, ENV_STEP_OFFSET);
+    Emit32 (e, remaining);
+    Emit8 (e, 0x5b);                                    // pop rbx
+    Emit8 (e, 0xc3);                                    // ret
+}
+
+
+/* conditional branch, env->pc = cond ? target : next pc */
+static void EmitBranch (jitEmitter *e, const blockInst *ip, uint8_t cc)
+{
+    EmitLoadGReg (e, EAX, ip->rs1);
+    EmitLoadGReg (e, ECX, ip->rs2);
+    EmitMovImm (e, EDX, ip->next_pc);
+    EmitMovImm (e, ESI, ip->pc + ip->imm);
+    Emit8 (e, 0x39); Emit8 (e, 0xc8);                   // cmp eax, ecx
+    Emit8 (e, 0x0f); Emit8 (e, 0x40 | cc); Emit8 (e, 0xd6);  // cmovcc edx, esi
+    Emit8 (e, 0x89); Emit8 (e, 0x93);                   // mov [rbx + pc], edx
+    Emit32 (e, ENV_PC_OFFSET);
+}
+
+
+/*!
+ * emit host code of one guest instruction
+ * \param remaining  number of instructions after this one in block
+ */
+static void EmitInst (jitEmitter *e, const blockInst *ip, uint32_t remaining)
+{
+    switch (ip->inst_idx) {
+    case INST_LUI :
+        EmitMovImm (e, EAX, ip->imm);
+        EmitStoreGReg (e, ip->rd, EAX);
+        return;
+    case INST_AUIPC :
+        EmitMovImm (e, EAX, ip->imm + ip->pc);
+        EmitStoreGReg (e, ip->rd, EAX);
+        return;
+    case INST_JAL :
+        EmitMovImm (e, EAX, ip->next_pc);
+        EmitStoreGReg (e, ip->rd, EAX);
+        EmitStoreEnvImm (e, ENV_PC_OFFSET, ip->pc + ip->imm);
+        return;
+    case INST_JALR :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        EmitAluImm (e, 0x05, ip->imm);                  // add eax, imm32
+        EmitMovImm (e, ECX, ip->next_pc);
+        EmitStoreGReg (e, ip->rd, ECX);
+        Emit8 (e, 0x89); Emit8 (e, 0x83);               // mov [rbx + pc], eax
+        Emit32 (e, ENV_PC_OFFSET);
+        return;
+
+    case INST_BEQ  : EmitBranch (e, ip, CC_E);  return;
+    case INST_BNE  : EmitBranch (e, ip, CC_NE); return;
+    case INST_BLT  : EmitBranch (e, ip, CC_L);  return;
+    case INST_BGE  : EmitBranch (e, ip, CC_GE); return;
+    case INST_BLTU : EmitBranch (e, ip, CC_B);  return;
+    case INST_BGEU : EmitBranch (e, ip, CC_AE); return;
+
+    case INST_LB :
+        EmitLoadMemory (e, ip, Size_Byte);
+        Emit8 (e, 0x0f); Emit8 (e, 0xbe); Emit8 (e, 0xc0);  // movsx eax, al
+        EmitStoreGReg (e, ip->rd, EAX);
+        return;
+    case INST_LH :
+        EmitLoadMemory (e, ip, Size_HWord);
+        Emit8 (e, 0x0f); Emit8 (e, 0xbf); Emit8 (e, 0xc0);  // movsx eax, ax
+        EmitStoreGReg (e, ip->rd, EAX);
+        return;
+    case INST_LW :
+        EmitLoadMemory (e, ip, Size_Word);
+        EmitStoreGReg (e, ip->rd, EAX);
+        return;
+    case INST_LBU :
+        EmitLoadMemory (e, ip, Size_Byte);
+        Emit8 (e, 0x0f); Emit8 (e, 0xb6); Emit8 (e, 0xc0);  // movzx eax, al
+        EmitStoreGReg (e, ip->rd, EAX);
+        return;
+    case INST_LHU :
+        EmitLoadMemory (e, ip, Size_HWord);
+        Emit8 (e, 0x0f); Emit8 (e, 0xb7); Emit8 (e, 0xc0);  // movzx eax, ax
+        EmitStoreGReg (e, ip->rd, EAX);
+        return;
+    }
+
+    if (ip->rd == 0) {
+        switch (ip->inst_idx) {
+        case INST_ADDI : case INST_SLTI : case INST_XORI : case INST_ORI :
+        case INST_ANDI : case INST_SLLI : case INST_SRLI : case INST_SRAI :
+        case INST_ADD  : case INST_SLL  : case INST_SLT  : case INST_SLTU :
+        case INST_XOR  : case INST_SRL  : case INST_SRA  : case INST_OR :
+        case INST_AND  : case INST_MUL :
+            return;
+        }
+    }
+
+    switch (ip->inst_idx) {
+    case INST_ADDI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        EmitAluImm (e, 0x05, ip->imm);                  // add eax, imm32
+        break;
+    case INST_SLTI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        EmitMovImm (e, ECX, ip->imm);
+        EmitSetCC (e, CC_L);
+        break;
+    case INST_XORI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        EmitAluImm (e, 0x35, ip->imm);                  // xor eax, imm32
+        break;
+    case INST_ORI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        EmitAluImm (e, 0x0d, ip->imm);                  // or eax, imm32
+        break;
+    case INST_ANDI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        EmitAluImm (e, 0x25, ip->imm);                  // and eax, imm32
+        break;
+    case INST_SLLI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        Emit8 (e, 0xc1); Emit8 (e, 0xe0); Emit8 (e, ip->rs2);  // shl eax, imm8
+        break;
+    case INST_SRLI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        Emit8 (e, 0xc1); Emit8 (e, 0xe8); Emit8 (e, ip->rs2);  // shr eax, imm8
+        break;
+    case INST_SRAI :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        Emit8 (e, 0xc1); Emit8 (e, 0xf8); Emit8 (e, ip->rs2);  // sar eax, imm8
+        break;
+    case INST_ADD : case INST_SLL : case INST_SLT : case INST_SLTU :
+    case INST_XOR : case INST_SRL : case INST_SRA : case INST_OR :
+    case INST_AND : case INST_MUL :
+        EmitLoadGReg (e, EAX, ip->rs1);
+        EmitLoadGReg (e, ECX, ip->rs2);
+        switch (ip->inst_idx) {
+        case INST_ADD  : EmitAluReg (e, 0x01); break;
+        case INST_XOR  : EmitAluReg (e, 0x31); break;
+        case INST_OR   : EmitAluReg (e, 0x09); break;
+        case INST_AND  : EmitAluReg (e, 0x21); break;
+        case INST_SLT  : EmitSetCC (e, CC_L);  break;
+        case INST_SLTU : EmitSetCC (e, CC_B);  break;
+        /* shift count in cl is masked to 5 bits by hardware */
+        case INST_SLL  : Emit8 (e, 0xd3); Emit8 (e, 0xe0); break;
+        case INST_SRL  : Emit8 (e, 0xd3); Emit8 (e, 0xe8); break;
+        case INST_SRA  : Emit8 (e, 0xd3); Emit8 (e, 0xf8); break;
+        case INST_MUL  : Emit8 (e, 0x0f); Emit8 (e, 0xaf); Emit8 (e, 0xc1); break;
+        }
+        break;
+    default :
+        /* call handler of instruction, as interpreter does */
+        EmitStoreEnvImm (e, ENV_PC_OFFSET, ip->pc);
+        EmitStoreEnvImm (e, ENV_CUR_PC_OFFSET, ip->pc);
+        EmitMovImm64 (e, EDI, (uint64_t)(uintptr_t)&ip->operand);  // operands live as long as the block
+        Emit8 (e, 0x48); Emit8 (e, 0x89); Emit8 (e, 0xde);  // mov rsi, rbx
+        EmitCall (e, (const void *)ip->exec);
+        if (remaining > 0) {
+            EmitStopCheck (e, ip, remaining);
+        }
+        return;
+    }
+    EmitStoreGReg (e, ip->rd, EAX);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "./basic.h"
+#include "./env.h"
+#include "./block.h"
+
+/*!
+ * x86-64 dynamic binary translation of hot basic blocks.
+ * translated block is called as void (*)(riscvEnv): guest registers stay
+ * in env->regs, memory is accessed through LoadMemory/StoreMemory, and
+ * env->pc is set to the next block on return.
+ */
+#define JIT_THRESHOLD       64                  // executions before translation
+#define JIT_CACHE_SIZE      (16 * 1024 * 1024)
+#define JIT_BLOCK_MAX_CODE  (BLOCK_MAX_INSTS * 96 + 64)
+
+typedef void (*jitFunc) (riscvEnv);
+
+typedef struct __jitCache *jitCache;
+struct __jitCache {
+    Byte_t   *code;       // executable code cache
+    size_t    used;
+
+    /* statistics */
+    UDWord_t  translated;
+    UDWord_t  rejected;   // blocks with instructions left to interpreter
+    UDWord_t  flushes;
+};
+
+
+jitCache CreateJITCache (void);
+void     DestroyJITCache (jitCache);
+void     FlushJITCache (riscvEnv);
+bool     TranslateBlock (block, riscvEnv);
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "./env.h"
+#include "./trace.h"
+#include "./trace_file.h"
+#include "./inst_print.h"
+#include "./log_writer.h"
+
+static void *FormatterMain (void *);
+static void  SubmitChunk (logWriter);
+
+
+/*!
+ * create log writer and start formatter threads
+ * \param fp       file pointer of text log
+ * \param threads  number of formatter threads
+ */
+logWriter CreateLogWriter (FILE *fp, uint32_t threads)
+{
+    if (threads < 1) {
+        threads = 1;
+    } else if (threads > LOG_MAX_THREADS) {
+        threads = LOG_MAX_THREADS;
+    }
+
+    logWriter lw = (logWriter) checked_malloc (sizeof (*lw));
+    memset (lw, 0, sizeof (*lw));
+    lw->fp      = fp;
+    lw->threads = threads;
+    lw->formatters = (logFormatter *) checked_malloc (sizeof (logFormatter) * threads);
+    pthread_mutex_init (&lw->lock, NULL);
+    pthread_cond_init (&lw->space, NULL);
+    pthread_cond_init (&lw->turn, NULL);
+
+    uint32_t i;
+    for (i = 0; i < threads; i++) {
+        logFormatter *f = &lw->formatters[i];
+        f->writer = lw;
+        atomic_init (&f->head, 0);
+        atomic_init (&f->tail, 0);
+        pthread_cond_init (&f->ready, NULL);
+        if (pthread_create (&f->thread, NULL, FormatterMain, f) != 0) {
+            perror ("pthread_create");
+            exit (EXIT_FAILURE);
+        }
+    }
+    return lw;
+}
+
+
+/*!
+ * push one step to log
+ * \param lw        log writer
+ * \param step      step number
+ * \param pc        PC of instruction
+ * \param inst_hex  instruction
+ * \param inst_idx  index of instruction, -1 if not decoded
+ * \param trace     trace of instruction
+ */
+void PushLogRecord (logWriter lw, UDWord_t step, Addr_t pc,
+                    Word_t inst_hex, uint32_t inst_idx, traceInfo trace)
+{
+    if (lw->current != NULL &&
+        lw->current->used + TRACE_RECORD_MAX_SIZE > LOG_CHUNK_SIZE) {
+        SubmitChunk (lw);
+    }
+
+    if (lw->current == NULL) {
+        /* wait for free slot of formatter in charge of next chunk */
+        logFormatter *f = &lw->formatters[lw->next_seq % lw->threads];
+        uint64_t head = atomic_load_explicit (&f->head, memory_order_relaxed);
+        if (head - atomic_load_explicit (&f->tail, memory_order_acquire) >= LOG_RING_SIZE) {
+            pthread_mutex_lock (&lw->lock);
+            while (head - atomic_load_explicit (&f->tail, memory_order_acquire) >= LOG_RING_SIZE) {
+                pthread_cond_wait (&lw->space, &lw->lock);
+            }
+            pthread_mutex_unlock (&lw->lock);
+        }
+        lw->current = &f->ring[head % LOG_RING_SIZE];
+        lw->current->seq  = lw->next_seq;
+        lw->current->used = 0;
+    }
+
+    lw->current->used += EncodeTraceRecord (lw->current->data + lw->current->used,
+                                            step, pc, inst_hex, inst_idx, trace);
+}
+
+
+/*!
+ * flush all records, stop formatter threads and release log writer
+ * \param lw  log writer
+ */
+void CloseLogWriter (logWriter lw)
+{
+    if (lw->current != NULL) {
+        SubmitChunk (lw);
+    }
+    uint32_t i;
+    pthread_mutex_lock (&lw->lock);
+    atomic_store_explicit (&lw->closing, true, memory_order_release);
+    for (i = 0; i < lw->threads; i++) {
+        pthread_cond_signal (&lw->formatters[i].ready);
+    }
+    pthread_mutex_unlock (&lw->lock);
+
+    for (i = 0; i < lw->threads; i++) {
+        pthread_join (lw->formatters[i].thread, NULL);
+        pthread_cond_destroy (&lw->formatters[i].ready);
+    }
+    fflush (lw->fp);
+
+    pthread_cond_destroy (&lw->turn);
+    pthread_cond_destroy (&lw->space);
+    pthread_mutex_destroy (&lw->lock);
+    free (lw->formatters);
+    free (lw);
+}
+
+
+/*!
+ * hand filled chunk to formatter
+ */
+static void SubmitChunk (logWriter lw)
+{
+    logFormatter *f = &lw->formatters[lw->next_seq % lw->threads];
+    pthread_mutex_lock (&lw->lock);
+    atomic_fetch_add_explicit (&f->head, 1, memory_order_release);
+    pthread_cond_signal (&f->ready);
+    pthread_mutex_unlock (&lw->lock);
+    lw->current = NULL;
+    lw->next_seq++;
+}
+
+
+/*!
+ * formatter thread: decode chunks into text, and write them in order
+ */
+static void *FormatterMain (void *arg)
+{
+    logFormatter *f  = (logFormatter *)arg;
+    logWriter     lw = f->writer;
+
+    /* text of one chunk, grows when needed */
+    size_t  text_size = LOG_CHUNK_SIZE * 4;
+    char   *text = (char *)malloc (text_size);
+    if (text == NULL) {
+        perror ("malloc");
+        exit (EXIT_FAILURE);
+    }
+
+    for (;;) {
+        uint64_t tail = atomic_load_explicit (&f->tail, memory_order_relaxed);
+        if (tail == atomic_load_explicit (&f->head, memory_order_acquire)) {
+            pthread_mutex_lock (&lw->lock);
+            while (tail == atomic_load_explicit (&f->head, memory_order_acquire) &&
+                   atomic_load_explicit (&lw->closing, memory_order_acquire) == false) {
+                pthread_cond_wait (&f->ready, &lw->lock);
+            }
+            pthread_mutex_unlock (&lw->lock);
+            if (tail == atomic_load_explicit (&f->head, memory_order_acquire)) {
+                break;   // closing, and all chunks are written
+            }
+        }
+
+        logChunk *chunk = &f->ring[tail % LOG_RING_SIZE];
+
+        size_t   length = 0;
+        uint32_t offset = 0;
+        while (offset < chunk->used) {
+            traceRecordHeader  header;
+            struct __traceInfo trace;
+            offset += DecodeTraceRecord (chunk->data + offset, &header, &trace);
+            uint32_t inst_idx = (header.inst_idx == TRACE_INST_ILLEGAL) ? -1 : header.inst_idx;
+            if (length + STEP_LOG_MAX > text_size) {
+                text_size *= 2;
+                if ((text = (char *)realloc (text, text_size)) == NULL) {
+                    perror ("realloc");
+                    exit (EXIT_FAILURE);
+                }
+            }
+            length += FormatStepLog (text + length, header.step, header.pc, header.inst_hex, inst_idx, &trace);
+        }
+
+        /* keep order of chunks among formatters */
+        if (atomic_load_explicit (&lw->write_seq, memory_order_acquire) != chunk->seq) {
+            pthread_mutex_lock (&lw->lock);
+            while (atomic_load_explicit (&lw->write_seq, memory_order_acquire) != chunk->seq) {
+                pthread_cond_wait (&lw->turn, &lw->lock);
+            }
+            pthread_mutex_unlock (&lw->lock);
+        }
+        fwrite (text, 1, length, lw->fp);
+
+        pthread_mutex_lock (&lw->lock);
+        atomic_store_explicit (&lw->write_seq, chunk->seq + 1, memory_order_release);
+        atomic_store_explicit (&f->tail, tail + 1, memory_order_release);
+        pthread_cond_broadcast (&lw->turn);
+        pthread_cond_broadcast (&lw->space);
+        pthread_mutex_unlock (&lw->lock);
+    }
+
+    free (text);
+    return NULL;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "./basic.h"
+#include "./trace.h"
+#include "./trace_file.h"
+
+/*!
+ * Asynchronous log writer
+ * simulation thread encodes steps into chunks of binary records
+ * (trace_file.h) and hands them to formatter threads. chunk n goes to
+ * formatter n % threads through single-producer/single-consumer ring, and
+ * formatters write text in chunk order, so the log is same as synchronous one.
+ * rings are fixed size, simulation waits when formatters fall behind.
+ * threads which have nothing to do sleep on condition variables of lock.
+ */
+#define LOG_CHUNK_SIZE     (64 * 1024)
+#define LOG_RING_SIZE      8             // chunks per formatter
+#define LOG_MAX_THREADS    16
+
+typedef struct {
+    uint64_t  seq;                    // chunk order in log
+    uint32_t  used;
+    Byte_t    data[LOG_CHUNK_SIZE];
+} logChunk;
+
+typedef struct __logWriter *logWriter;
+
+typedef struct {
+    logWriter         writer;
+    pthread_t         thread;
+    logChunk          ring[LOG_RING_SIZE];
+    _Atomic uint64_t  head;           // written by simulation thread
+    _Atomic uint64_t  tail;           // written by formatter thread
+    pthread_cond_t    ready;          // chunk is submitted, or writer is closing
+} logFormatter;
+
+struct __logWriter {
+    FILE             *fp;
+    uint32_t          threads;
+    logFormatter     *formatters;
+    logChunk         *current;        // chunk being filled, NULL if none
+    uint64_t          next_seq;       // sequence of next chunk to be filled
+    _Atomic uint64_t  write_seq;      // sequence of next chunk to be written
+    _Atomic bool      closing;
+    pthread_mutex_t   lock;           // held while head, tail, write_seq and closing change
+    pthread_cond_t    space;          // formatter released a chunk
+    pthread_cond_t    turn;           // write_seq is advanced
+};
+
+
+logWriter CreateLogWriter (FILE *, uint32_t);
+void      PushLogRecord (logWriter, UDWord_t, Addr_t, Word_t, uint32_t, traceInfo);
+void      CloseLogWriter (logWriter);
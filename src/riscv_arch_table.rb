@@ -1,174 +1,257 @@
-#!/bin/ruby
-#
-# Copyright (c) 2015, Masayuki Kimura
-# All rights reserved.
-#
-#     Redistribution and use in source and binary forms, with or without
-#     modification, are permitted provided that the following conditions are met:
-#     * Redistributions of source code must retain the above copyright
-#     notice, this list of conditions and the following disclaimer.
-#     * Redistributions in binary form must reproduce the above copyright
-#     notice, this list of conditions and the following disclaimer in the
-#       documentation and/or other materials provided with the distribution.
-#     * Neither the name of the Masayuki Kimura nor the
-#       names of its contributors may be used to endorse or promote products
-#       derived from this software without specific prior written permission.
-#
-# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-#     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-# DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
-#     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-#     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-#      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-#     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-#     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-#     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-#
-
-$arch_table = Array[]  # instruction table
-
-module ARCH
-  NAME      = 0
-  R3        = 1
-  F2        = 2
-  R2        = 3
-  R1        = 4
-  F3        = 5
-  RD        = 6
-  OP        = 7
-  KEY_TABLE = 8
-  TAIL      = 9
-end
-
-
-## start of RISC-V instructions
-#                       ['BITFIELD'                                       31-27,   26-25,    24-20    19-15    14-12     11-07    06-00    ]
-#                       ['NAME',                                          'rs3',   'funct2', 'rs2',   'rs1',   'funct3', 'rd',    'opcode' , DecodeTable]
-#                       ['DECODE-KEY',                                    'R3',    'F2'      'R2',    'R1',    'F3',     'RD'     'OP'     ]
-$arch_table[  0] = Array['lui        d[11:7],h[31:12]',                   'XXXXX', 'XX',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '0110111', Array['OP']]
-$arch_table[  1] = Array['auipc      d[11:7],h[31:12]',                   'XXXXX', 'XX',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '0010111', Array['OP']]
-$arch_table[  2] = Array['jal        d[11:7],uj[31:12]',                  'XXXXX', 'XX',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1101111', Array['OP']]
-$arch_table[  3] = Array['jalr       d[11:7],d[19:15],d[11:0]',           'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1100111', Array['OP']]
-$arch_table[  4] = Array['beq        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1100011', Array['OP', 'F3']]
-$arch_table[  5] = Array['bne        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1100011', Array['OP', 'F3']]
-$arch_table[  6] = Array['blt        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '100',    'XXXXX', '1100011', Array['OP', 'F3']]
-$arch_table[  7] = Array['bge        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '101',    'XXXXX', '1100011', Array['OP', 'F3']]
-$arch_table[  8] = Array['bltu       d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '110',    'XXXXX', '1100011', Array['OP', 'F3']]
-$arch_table[  9] = Array['bgeu       d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '111',    'XXXXX', '1100011', Array['OP', 'F3']]
-$arch_table[ 10] = Array['lb         d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0000011', Array['OP', 'F3']]
-$arch_table[ 11] = Array['lh         d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0000011', Array['OP', 'F3']]
-$arch_table[ 12] = Array['lw         d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0000011', Array['OP', 'F3']]
-$arch_table[ 13] = Array['lbu        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0000011', Array['OP', 'F3']]
-$arch_table[ 14] = Array['lhu        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0000011', Array['OP', 'F3']]
-$arch_table[ 15] = Array['sb         d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0100011', Array['OP', 'F3']]
-$arch_table[ 16] = Array['sh         d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0100011', Array['OP', 'F3']]
-$arch_table[ 17] = Array['sw         d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0100011', Array['OP', 'F3']]
-$arch_table[ 18] = Array['addi       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0010011', Array['OP', 'F3']]
-$arch_table[ 19] = Array['slti       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0010011', Array['OP', 'F3']]
-$arch_table[ 20] = Array['sltiu      d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0010011', Array['OP', 'F3']]
-$arch_table[ 21] = Array['xori       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0010011', Array['OP', 'F3']]
-$arch_table[ 22] = Array['ori        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '110',    'XXXXX', '0010011', Array['OP', 'F3']]
-$arch_table[ 23] = Array['andi       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '111',    'XXXXX', '0010011', Array['OP', 'F3']]
-$arch_table[ 24] = Array['slli       d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0010011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 25] = Array['srli       d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0010011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 26] = Array['srai       d[11:7],d[19:15],d[24:20]',          '01000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0010011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 27] = Array['add        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 28] = Array['sub        d[11:7],d[19:15],d[24:20]',          '01000', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 29] = Array['sll        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 30] = Array['slt        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 31] = Array['sltu       d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 32] = Array['xor        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 33] = Array['srl        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 34] = Array['sra        d[11:7],d[19:15],d[24:20]',          '01000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 35] = Array['or         d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '110',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 36] = Array['and        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '111',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 37] = Array['fence',                                         '0000X', 'XX',     'XXXXX', '00000', '000',    'XXXXX', '0001111', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 38] = Array['fence.i',                                       '00000', '00',     '00000', '00000', '001',    'XXXXX', '0001111', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 39] = Array['scall',                                         '00000', '00',     '00000', '00000', '000',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 40] = Array['sbreak',                                        '00000', '00',     '00001', '00000', '000',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 41] = Array['rdcycle    d[11:7]',                            '11000', '00',     '00000', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 42] = Array['rdcycleh   d[11:7]',                            '11001', '00',     '00000', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 43] = Array['rdtime     d[11:7]',                            '11000', '00',     '00001', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 44] = Array['rdtimeh    d[11:7]',                            '11001', '00',     '00001', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 45] = Array['rdinstret  d[11:7]',                            '11000', '00',     '00010', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 46] = Array['rdinstreth d[11:7]',                            '11001', '00',     '00010', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
-$arch_table[ 47] = Array['mul        d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 48] = Array['mulh       d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 49] = Array['mulhsu     d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 50] = Array['mulhu      d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 51] = Array['div        d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 52] = Array['divu       d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 53] = Array['rem        d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '110',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 54] = Array['remu       d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '111',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
-$arch_table[ 55] = Array['lr.w       d[11:7],d[19:15]',                   '00010', 'XX',     '00000', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3', 'R2']]
-$arch_table[ 56] = Array['sc.w       d[11:7],d[19:15],d[24:20]',          '00011', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 57] = Array['amoswap.w  d[11:7],d[19:15],d[24:20]',          '00001', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 58] = Array['amoadd.w   d[11:7],d[19:15],d[24:20]',          '00000', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 59] = Array['amoxor.w   d[11:7],d[19:15],d[24:20]',          '00100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 60] = Array['amoand.w   d[11:7],d[19:15],d[24:20]',          '01100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 61] = Array['amoor.w    d[11:7],d[19:15],d[24:20]',          '01000', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 62] = Array['amomin.w   d[11:7],d[19:15],d[24:20]',          '10010', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 63] = Array['amomax.w   d[11:7],d[19:15],d[24:20]',          '10100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 64] = Array['amominu.w  d[11:7],d[19:15],d[24:20]',          '11000', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 65] = Array['amomaxu.w  d[11:7],d[19:15],d[24:20]',          '11100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
-$arch_table[ 66] = Array['flw        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0000111', Array['OP', 'F3']]
-$arch_table[ 67] = Array['fsw        d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0100111', Array['OP', 'F3']]
-$arch_table[ 68] = Array['fmadd.s    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000011', Array['OP', 'F2']]
-$arch_table[ 69] = Array['fmsub.s    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000111', Array['OP', 'F2']]
-$arch_table[ 70] = Array['fnmsub.s   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001011', Array['OP', 'F2']]
-$arch_table[ 71] = Array['fnmadd.s   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001111', Array['OP', 'F2']]
-$arch_table[ 72] = Array['fadd.s     d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[ 73] = Array['fsub.s     d[11:7],d[19:15],d[24:20]',          '00001', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[ 74] = Array['fmul.s     d[11:7],d[19:15],d[24:20]',          '00010', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[ 75] = Array['fdiv.s     d[11:7],d[19:15],d[24:20]',          '00011', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[ 76] = Array['fsqrt.s    d[11:7],d[19:15]',                   '01011', '00',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 77] = Array['fsgnj.s    d[11:7],d[19:15],d[24:20]',          '00100', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 78] = Array['fsgnjn.s   d[11:7],d[19:15],d[24:20]',          '00100', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 79] = Array['fsgnjx.s   d[11:7],d[19:15],d[24:20]',          '00100', '00',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 80] = Array['fmin.s     d[11:7],d[19:15],d[24:20]',          '00101', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 81] = Array['fmax.s     d[11:7],d[19:15],d[24:20]',          '00101', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 82] = Array['fcvt.w.s   d[11:7],d[19:15]',                   '11000', '00',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 83] = Array['fcvt.wu.s  d[11:7],d[19:15]',                   '11000', '00',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 84] = Array['fmv.x.s    d[11:7],d[19:15]',                   '11100', '00',     '00000', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
-$arch_table[ 85] = Array['feq.s      d[11:7],d[19:15],d[24:20]',          '10100', '00',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 86] = Array['flt.s      d[11:7],d[19:15],d[24:20]',          '10100', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 87] = Array['fle.s      d[11:7],d[19:15],d[24:20]',          '10100', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
-$arch_table[ 88] = Array['fclass.s   d[11:7],d[19:15]',                   '11100', '00',     '00000', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
-$arch_table[ 89] = Array['fcvt.s.w   d[11:7],d[19:15]',                   '11010', '00',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 90] = Array['fcvt.s.wu  d[11:7],d[19:15]',                   '11010', '00',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 91] = Array['fmv.s.x    d[11:7],d[19:15]',                   '11110', '00',     '00000', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
-$arch_table[ 92] = Array['frcsr      d[11:7]',                            '00000', '00',     '00011', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2', 'R1', 'F3']]
-$arch_table[ 93] = Array['frrm       d[11:7]',                            '00000', '00',     '00010', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2', 'R1', 'F3']]
-$arch_table[ 94] = Array['frflags    d[11:7]',                            '00000', '00',     '00001', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2', 'R1', 'F3']]
-$arch_table[ 95] = Array['fscsr      d[11:7],d[19:15]',                   '00000', '00',     '00011', 'XXXXX', '001',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 96] = Array['fsrm       d[11:7],d[19:15]',                   '00000', '00',     '00010', 'XXXXX', '001',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 97] = Array['fsflags    d[11:7],d[19:15]',                   '00000', '00',     '00001', 'XXXXX', '001',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[ 98] = Array['fsrmi      d[11:7]',                            '00000', '00',     '00010', '00000', '101',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2', 'R1', 'F3']]
-$arch_table[ 99] = Array['fsflagsi   d[11:7]',                            '00000', '00',     '00001', '00000', '101',    'XXXXX', '1110011', Array['OP', 'F2', 'R3', 'R2', 'R1', 'F3']]
-$arch_table[100] = Array['fld        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0000111', Array['OP', 'F3']]
-$arch_table[101] = Array['fsd        d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0100111', Array['OP', 'F3']]
-$arch_table[102] = Array['fmadd.d    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000011', Array['OP', 'F2']]
-$arch_table[103] = Array['fmsub.d    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000111', Array['OP', 'F2']]
-$arch_table[104] = Array['fnmsub.d   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001011', Array['OP', 'F2']]
-$arch_table[105] = Array['fnmadd.d   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001111', Array['OP', 'F2']]
-$arch_table[106] = Array['fadd.d     d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[107] = Array['fsub.d     d[11:7],d[19:15],d[24:20]',          '00001', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[108] = Array['fmul.d     d[11:7],d[19:15],d[24:20]',          '00010', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[109] = Array['fdiv.d     d[11:7],d[19:15],d[24:20]',          '00011', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[110] = Array['fsqrt.d    d[11:7],d[19:15]',                   '01011', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[111] = Array['fsgnj.d    d[11:7],d[19:15],d[24:20]',          '00100', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[112] = Array['fsgnjn.d   d[11:7],d[19:15],d[24:20]',          '00100', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[113] = Array['fsgnjx.d   d[11:7],d[19:15],d[24:20]',          '00100', '01',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[114] = Array['fmin.d     d[11:7],d[19:15],d[24:20]',          '00101', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[115] = Array['fmax.d     d[11:7],d[19:15],d[24:20]',          '00101', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[116] = Array['fcvt.s.d   d[11:7],d[19:15]',                   '01000', '00',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[117] = Array['fcvt.d.s   d[11:7],d[19:15]',                   '01000', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[118] = Array['feq.d      d[11:7],d[19:15],d[24:20]',          '10100', '01',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[119] = Array['flt.d      d[11:7],d[19:15],d[24:20]',          '10100', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[120] = Array['fle.d      d[11:7],d[19:15],d[24:20]',          '10100', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
-$arch_table[121] = Array['fclass.d   d[11:7],d[19:15]',                   '11100', '01',     '00000', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
-$arch_table[122] = Array['fcvt.w.d   d[11:7],d[19:15]',                   '11000', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[123] = Array['fcvt.wu.d  d[11:7],d[19:15]',                   '11000', '01',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[124] = Array['fcvt.d.w   d[11:7],d[19:15]',                   '11010', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
-$arch_table[125] = Array['fcvt.d.wu  d[11:7],d[19:15]',                   '11010', '01',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+#!/bin/ruby
+#
+# Copyright (c) 2015, Masayuki Kimura
+# All rights reserved.
+#
+#     Redistribution and use in source and binary forms, with or without
+#     modification, are permitted provided that the following conditions are met:
+#     * Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the name of the Masayuki Kimura nor the
+#       names of its contributors may be used to endorse or promote products
+#       derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+#     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+#     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+#     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+#      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+#     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+$arch_table = Array[]  # instruction table
+
+module ARCH
+  NAME      = 0
+  R3        = 1
+  F2        = 2
+  R2        = 3
+  R1        = 4
+  F3        = 5
+  RD        = 6
+  OP        = 7
+  KEY_TABLE = 8
+  TAIL      = 9
+end
+
+
+## operand format of each major opcode
+$format_table = Hash[
+  '0110111' => 'U',    # LUI
+  '0010111' => 'U',    # AUIPC
+  '1101111' => 'UJ',   # JAL
+  '1100111' => 'I',    # JALR
+  '1100011' => 'SB',   # BRANCH
+  '0000011' => 'I',    # LOAD
+  '0100011' => 'S',    # STORE
+  '0010011' => 'I',    # OP-IMM
+  '0110011' => 'R',    # OP
+  '0001111' => 'I',    # MISC-MEM
+  '1110011' => 'I',    # SYSTEM
+  '0101111' => 'R',    # AMO
+  '0000111' => 'I',    # LOAD-FP
+  '0100111' => 'S',    # STORE-FP
+  '1000011' => 'R4',   # FMADD
+  '1000111' => 'R4',   # FMSUB
+  '1001011' => 'R4',   # FNMSUB
+  '1001111' => 'R4',   # FNMADD
+  '1010011' => 'R',    # OP-FP
+]
+
+
+## start of RISC-V instructions
+#                       ['BITFIELD'                                       31-27,   26-25,    24-20    19-15    14-12     11-07    06-00    ]
+#                       ['NAME',                                          'rs3',   'funct2', 'rs2',   'rs1',   'funct3', 'rd',    'opcode' , DecodeTable]
+#                       ['DECODE-KEY',                                    'R3',    'F2'      'R2',    'R1',    'F3',     'RD'     'OP'     ]
+$arch_table[  0] = Array['lui        d[11:7],h[31:12]',                   'XXXXX', 'XX',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '0110111', Array['OP']]
+$arch_table[  1] = Array['auipc      d[11:7],h[31:12]',                   'XXXXX', 'XX',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '0010111', Array['OP']]
+$arch_table[  2] = Array['jal        d[11:7],uj[31:12]',                  'XXXXX', 'XX',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1101111', Array['OP']]
+$arch_table[  3] = Array['jalr       d[11:7],d[19:15],d[11:0]',           'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1100111', Array['OP', 'F3']]
+$arch_table[  4] = Array['beq        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1100011', Array['OP', 'F3']]
+$arch_table[  5] = Array['bne        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1100011', Array['OP', 'F3']]
+$arch_table[  6] = Array['blt        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '100',    'XXXXX', '1100011', Array['OP', 'F3']]
+$arch_table[  7] = Array['bge        d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '101',    'XXXXX', '1100011', Array['OP', 'F3']]
+$arch_table[  8] = Array['bltu       d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '110',    'XXXXX', '1100011', Array['OP', 'F3']]
+$arch_table[  9] = Array['bgeu       d[19:15],d[24:20],sb[31:25]',        'XXXXX', 'XX',     'XXXXX', 'XXXXX', '111',    'XXXXX', '1100011', Array['OP', 'F3']]
+$arch_table[ 10] = Array['lb         d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0000011', Array['OP', 'F3']]
+$arch_table[ 11] = Array['lh         d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0000011', Array['OP', 'F3']]
+$arch_table[ 12] = Array['lw         d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0000011', Array['OP', 'F3']]
+$arch_table[ 13] = Array['lbu        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0000011', Array['OP', 'F3']]
+$arch_table[ 14] = Array['lhu        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0000011', Array['OP', 'F3']]
+$arch_table[ 15] = Array['sb         d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0100011', Array['OP', 'F3']]
+$arch_table[ 16] = Array['sh         d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0100011', Array['OP', 'F3']]
+$arch_table[ 17] = Array['sw         d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0100011', Array['OP', 'F3']]
+$arch_table[ 18] = Array['addi       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0010011', Array['OP', 'F3']]
+$arch_table[ 19] = Array['slti       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0010011', Array['OP', 'F3']]
+$arch_table[ 20] = Array['sltiu      d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0010011', Array['OP', 'F3']]
+$arch_table[ 21] = Array['xori       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0010011', Array['OP', 'F3']]
+$arch_table[ 22] = Array['ori        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '110',    'XXXXX', '0010011', Array['OP', 'F3']]
+$arch_table[ 23] = Array['andi       d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '111',    'XXXXX', '0010011', Array['OP', 'F3']]
+$arch_table[ 24] = Array['slli       d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0010011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 25] = Array['srli       d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0010011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 26] = Array['srai       d[11:7],d[19:15],d[24:20]',          '01000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0010011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 27] = Array['add        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 28] = Array['sub        d[11:7],d[19:15],d[24:20]',          '01000', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 29] = Array['sll        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 30] = Array['slt        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 31] = Array['sltu       d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 32] = Array['xor        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 33] = Array['srl        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 34] = Array['sra        d[11:7],d[19:15],d[24:20]',          '01000', '00',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 35] = Array['or         d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '110',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 36] = Array['and        d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', '111',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 37] = Array['fence',                                         'XXXXX', 'XX',     'XXXXX', '00000', '000',    'XXXXX', '0001111', Array['OP', 'F3', 'R1']]
+$arch_table[ 38] = Array['fence.i',                                       '00000', '00',     '00000', '00000', '001',    'XXXXX', '0001111', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 39] = Array['scall',                                         '00000', '00',     '00000', '00000', '000',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 40] = Array['sbreak',                                        '00000', '00',     '00001', '00000', '000',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 41] = Array['rdcycle    d[11:7]',                            '11000', '00',     '00000', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 42] = Array['rdcycleh   d[11:7]',                            '11001', '00',     '00000', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 43] = Array['rdtime     d[11:7]',                            '11000', '00',     '00001', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 44] = Array['rdtimeh    d[11:7]',                            '11001', '00',     '00001', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 45] = Array['rdinstret  d[11:7]',                            '11000', '00',     '00010', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 46] = Array['rdinstreth d[11:7]',                            '11001', '00',     '00010', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 47] = Array['mul        d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 48] = Array['mulh       d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 49] = Array['mulhsu     d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 50] = Array['mulhu      d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 51] = Array['div        d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '100',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 52] = Array['divu       d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '101',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 53] = Array['rem        d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '110',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 54] = Array['remu       d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', '111',    'XXXXX', '0110011', Array['OP', 'F3', 'F2', 'R3']]
+$arch_table[ 55] = Array['lr.w       d[11:7],d[19:15]',                   '00010', 'XX',     '00000', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3', 'R2']]
+$arch_table[ 56] = Array['sc.w       d[11:7],d[19:15],d[24:20]',          '00011', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 57] = Array['amoswap.w  d[11:7],d[19:15],d[24:20]',          '00001', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 58] = Array['amoadd.w   d[11:7],d[19:15],d[24:20]',          '00000', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 59] = Array['amoxor.w   d[11:7],d[19:15],d[24:20]',          '00100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 60] = Array['amoand.w   d[11:7],d[19:15],d[24:20]',          '01100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 61] = Array['amoor.w    d[11:7],d[19:15],d[24:20]',          '01000', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 62] = Array['amomin.w   d[11:7],d[19:15],d[24:20]',          '10010', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 63] = Array['amomax.w   d[11:7],d[19:15],d[24:20]',          '10100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 64] = Array['amominu.w  d[11:7],d[19:15],d[24:20]',          '11000', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 65] = Array['amomaxu.w  d[11:7],d[19:15],d[24:20]',          '11100', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0101111', Array['OP', 'F3', 'R3']]
+$arch_table[ 66] = Array['flw        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0000111', Array['OP', 'F3']]
+$arch_table[ 67] = Array['fsw        d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '010',    'XXXXX', '0100111', Array['OP', 'F3']]
+$arch_table[ 68] = Array['fmadd.s    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000011', Array['OP', 'F2']]
+$arch_table[ 69] = Array['fmsub.s    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000111', Array['OP', 'F2']]
+$arch_table[ 70] = Array['fnmsub.s   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001011', Array['OP', 'F2']]
+$arch_table[ 71] = Array['fnmadd.s   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001111', Array['OP', 'F2']]
+$arch_table[ 72] = Array['fadd.s     d[11:7],d[19:15],d[24:20]',          '00000', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[ 73] = Array['fsub.s     d[11:7],d[19:15],d[24:20]',          '00001', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[ 74] = Array['fmul.s     d[11:7],d[19:15],d[24:20]',          '00010', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[ 75] = Array['fdiv.s     d[11:7],d[19:15],d[24:20]',          '00011', '00',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[ 76] = Array['fsqrt.s    d[11:7],d[19:15]',                   '01011', '00',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[ 77] = Array['fsgnj.s    d[11:7],d[19:15],d[24:20]',          '00100', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 78] = Array['fsgnjn.s   d[11:7],d[19:15],d[24:20]',          '00100', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 79] = Array['fsgnjx.s   d[11:7],d[19:15],d[24:20]',          '00100', '00',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 80] = Array['fmin.s     d[11:7],d[19:15],d[24:20]',          '00101', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 81] = Array['fmax.s     d[11:7],d[19:15],d[24:20]',          '00101', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 82] = Array['fcvt.w.s   d[11:7],d[19:15]',                   '11000', '00',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[ 83] = Array['fcvt.wu.s  d[11:7],d[19:15]',                   '11000', '00',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[ 84] = Array['fmv.x.s    d[11:7],d[19:15]',                   '11100', '00',     '00000', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
+$arch_table[ 85] = Array['feq.s      d[11:7],d[19:15],d[24:20]',          '10100', '00',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 86] = Array['flt.s      d[11:7],d[19:15],d[24:20]',          '10100', '00',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 87] = Array['fle.s      d[11:7],d[19:15],d[24:20]',          '10100', '00',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[ 88] = Array['fclass.s   d[11:7],d[19:15]',                   '11100', '00',     '00000', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
+$arch_table[ 89] = Array['fcvt.s.w   d[11:7],d[19:15]',                   '11010', '00',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[ 90] = Array['fcvt.s.wu  d[11:7],d[19:15]',                   '11010', '00',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[ 91] = Array['fmv.s.x    d[11:7],d[19:15]',                   '11110', '00',     '00000', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
+$arch_table[ 92] = Array['frcsr      d[11:7]',                            '00000', '00',     '00011', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 93] = Array['frrm       d[11:7]',                            '00000', '00',     '00010', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 94] = Array['frflags    d[11:7]',                            '00000', '00',     '00001', '00000', '010',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 95] = Array['fscsr      d[11:7],d[19:15]',                   '00000', '00',     '00011', 'XXXXX', '001',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
+$arch_table[ 96] = Array['fsrm       d[11:7],d[19:15]',                   '00000', '00',     '00010', 'XXXXX', '001',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
+$arch_table[ 97] = Array['fsflags    d[11:7],d[19:15]',                   '00000', '00',     '00001', 'XXXXX', '001',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2']]
+$arch_table[ 98] = Array['fsrmi      d[11:7]',                            '00000', '00',     '00010', '00000', '101',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[ 99] = Array['fsflagsi   d[11:7]',                            '00000', '00',     '00001', '00000', '101',    'XXXXX', '1110011', Array['OP', 'F3', 'F2', 'R3', 'R2', 'R1']]
+$arch_table[100] = Array['fld        d[11:7],d[19:15],h[31:20]',          'XXXXX', 'XX',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0000111', Array['OP', 'F3']]
+$arch_table[101] = Array['fsd        d[19:15],d[24:20],h[31:25]|d[11:7]', 'XXXXX', 'XX',     'XXXXX', 'XXXXX', '011',    'XXXXX', '0100111', Array['OP', 'F3']]
+$arch_table[102] = Array['fmadd.d    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000011', Array['OP', 'F2']]
+$arch_table[103] = Array['fmsub.d    d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1000111', Array['OP', 'F2']]
+$arch_table[104] = Array['fnmsub.d   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001011', Array['OP', 'F2']]
+$arch_table[105] = Array['fnmadd.d   d[11:7],d[19:15],d[24:20],h[31:27]', 'XXXXX', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1001111', Array['OP', 'F2']]
+$arch_table[106] = Array['fadd.d     d[11:7],d[19:15],d[24:20]',          '00000', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[107] = Array['fsub.d     d[11:7],d[19:15],d[24:20]',          '00001', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[108] = Array['fmul.d     d[11:7],d[19:15],d[24:20]',          '00010', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[109] = Array['fdiv.d     d[11:7],d[19:15],d[24:20]',          '00011', '01',     'XXXXX', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3']]
+$arch_table[110] = Array['fsqrt.d    d[11:7],d[19:15]',                   '01011', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[111] = Array['fsgnj.d    d[11:7],d[19:15],d[24:20]',          '00100', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[112] = Array['fsgnjn.d   d[11:7],d[19:15],d[24:20]',          '00100', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[113] = Array['fsgnjx.d   d[11:7],d[19:15],d[24:20]',          '00100', '01',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[114] = Array['fmin.d     d[11:7],d[19:15],d[24:20]',          '00101', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[115] = Array['fmax.d     d[11:7],d[19:15],d[24:20]',          '00101', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[116] = Array['fcvt.s.d   d[11:7],d[19:15]',                   '01000', '00',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[117] = Array['fcvt.d.s   d[11:7],d[19:15]',                   '01000', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[118] = Array['feq.d      d[11:7],d[19:15],d[24:20]',          '10100', '01',     'XXXXX', 'XXXXX', '010',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[119] = Array['flt.d      d[11:7],d[19:15],d[24:20]',          '10100', '01',     'XXXXX', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[120] = Array['fle.d      d[11:7],d[19:15],d[24:20]',          '10100', '01',     'XXXXX', 'XXXXX', '000',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'F3']]
+$arch_table[121] = Array['fclass.d   d[11:7],d[19:15]',                   '11100', '01',     '00000', 'XXXXX', '001',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2', 'F3']]
+$arch_table[122] = Array['fcvt.w.d   d[11:7],d[19:15]',                   '11000', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[123] = Array['fcvt.wu.d  d[11:7],d[19:15]',                   '11000', '01',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[124] = Array['fcvt.d.w   d[11:7],d[19:15]',                   '11010', '01',     '00000', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+$arch_table[125] = Array['fcvt.d.wu  d[11:7],d[19:15]',                   '11010', '01',     '00001', 'XXXXX', 'XXX',    'XXXXX', '1010011', Array['OP', 'F2', 'R3', 'R2']]
+
+
+## start of RISC-V compressed instructions (RV32C, with F / D loads and stores)
+## every 16-bit instruction is expanded into the 32-bit instruction of $arch_table
+## named by EXPAND, and executed by its handler.
+##
+## operands of the expanded instruction:
+##   'rd' / 'rs1' / 'rs2' : [msb, lsb] of register field, [msb, lsb, 8] of rd' / rs1' / rs2' (x8-x15),
+##                          or number of fixed register
+##   'imm' / 'uimm'       : list of [msb, lsb, position] slices, 'imm' is sign extended from its highest bit
+##   'nzimm' / 'nzuimm'   : same as 'imm' / 'uimm', and the encoding is illegal if it is zero
+## entries which are expanded into nil are reserved encodings.
+## patterns are tested in order, so the first matching entry wins.
+$rvc_table = Array[]
+
+module RVC
+  NAME    = 0
+  PATTERN = 1
+  EXPAND  = 2
+  OPERAND = 3
+end
+
+#                        ['NAME',        15-------------0,   'EXPAND', Hash[operands of expanded instruction]]
+$rvc_table[ 0] = Array['c.addi4spn', '000XXXXXXXXXXX00', 'addi',   Hash['rd' => [4, 2, 8], 'rs1' => 2, 'nzuimm' => [[12, 11, 4], [10, 7, 6], [6, 6, 2], [5, 5, 3]]]]
+$rvc_table[ 1] = Array['c.fld',      '001XXXXXXXXXXX00', 'fld',    Hash['rd' => [4, 2, 8], 'rs1' => [9, 7, 8], 'uimm' => [[12, 10, 3], [6, 5, 6]]]]
+$rvc_table[ 2] = Array['c.lw',       '010XXXXXXXXXXX00', 'lw',     Hash['rd' => [4, 2, 8], 'rs1' => [9, 7, 8], 'uimm' => [[12, 10, 3], [6, 6, 2], [5, 5, 6]]]]
+$rvc_table[ 3] = Array['c.flw',      '011XXXXXXXXXXX00', 'flw',    Hash['rd' => [4, 2, 8], 'rs1' => [9, 7, 8], 'uimm' => [[12, 10, 3], [6, 6, 2], [5, 5, 6]]]]
+$rvc_table[ 4] = Array['c.fsd',      '101XXXXXXXXXXX00', 'fsd',    Hash['rs1' => [9, 7, 8], 'rs2' => [4, 2, 8], 'uimm' => [[12, 10, 3], [6, 5, 6]]]]
+$rvc_table[ 5] = Array['c.sw',       '110XXXXXXXXXXX00', 'sw',     Hash['rs1' => [9, 7, 8], 'rs2' => [4, 2, 8], 'uimm' => [[12, 10, 3], [6, 6, 2], [5, 5, 6]]]]
+$rvc_table[ 6] = Array['c.fsw',      '111XXXXXXXXXXX00', 'fsw',    Hash['rs1' => [9, 7, 8], 'rs2' => [4, 2, 8], 'uimm' => [[12, 10, 3], [6, 6, 2], [5, 5, 6]]]]
+$rvc_table[ 7] = Array['c.addi',     '000XXXXXXXXXXX01', 'addi',   Hash['rd' => [11, 7], 'rs1' => [11, 7], 'imm' => [[12, 12, 5], [6, 2, 0]]]]
+$rvc_table[ 8] = Array['c.jal',      '001XXXXXXXXXXX01', 'jal',    Hash['rd' => 1, 'imm' => [[12, 12, 11], [11, 11, 4], [10, 9, 8], [8, 8, 10], [7, 7, 6], [6, 6, 7], [5, 3, 1], [2, 2, 5]]]]
+$rvc_table[ 9] = Array['c.li',       '010XXXXXXXXXXX01', 'addi',   Hash['rd' => [11, 7], 'rs1' => 0, 'imm' => [[12, 12, 5], [6, 2, 0]]]]
+$rvc_table[10] = Array['c.addi16sp', '011X00010XXXXX01', 'addi',   Hash['rd' => 2, 'rs1' => 2, 'nzimm' => [[12, 12, 9], [6, 6, 4], [5, 5, 6], [4, 3, 7], [2, 2, 5]]]]
+$rvc_table[11] = Array['c.lui',      '011XXXXXXXXXXX01', 'lui',    Hash['rd' => [11, 7], 'nzimm' => [[12, 12, 17], [6, 2, 12]]]]
+$rvc_table[12] = Array['c.srli',     '100000XXXXXXXX01', 'srli',   Hash['rd' => [9, 7, 8], 'rs1' => [9, 7, 8], 'uimm' => [[6, 2, 0]]]]
+$rvc_table[13] = Array['c.srai',     '100001XXXXXXXX01', 'srai',   Hash['rd' => [9, 7, 8], 'rs1' => [9, 7, 8], 'uimm' => [[6, 2, 0]]]]
+$rvc_table[14] = Array['c.andi',     '100X10XXXXXXXX01', 'andi',   Hash['rd' => [9, 7, 8], 'rs1' => [9, 7, 8], 'imm' => [[12, 12, 5], [6, 2, 0]]]]
+$rvc_table[15] = Array['c.sub',      '100011XXX00XXX01', 'sub',    Hash['rd' => [9, 7, 8], 'rs1' => [9, 7, 8], 'rs2' => [4, 2, 8]]]
+$rvc_table[16] = Array['c.xor',      '100011XXX01XXX01', 'xor',    Hash['rd' => [9, 7, 8], 'rs1' => [9, 7, 8], 'rs2' => [4, 2, 8]]]
+$rvc_table[17] = Array['c.or',       '100011XXX10XXX01', 'or',     Hash['rd' => [9, 7, 8], 'rs1' => [9, 7, 8], 'rs2' => [4, 2, 8]]]
+$rvc_table[18] = Array['c.and',      '100011XXX11XXX01', 'and',    Hash['rd' => [9, 7, 8], 'rs1' => [9, 7, 8], 'rs2' => [4, 2, 8]]]
+$rvc_table[19] = Array['c.j',        '101XXXXXXXXXXX01', 'jal',    Hash['rd' => 0, 'imm' => [[12, 12, 11], [11, 11, 4], [10, 9, 8], [8, 8, 10], [7, 7, 6], [6, 6, 7], [5, 3, 1], [2, 2, 5]]]]
+$rvc_table[20] = Array['c.beqz',     '110XXXXXXXXXXX01', 'beq',    Hash['rs1' => [9, 7, 8], 'rs2' => 0, 'imm' => [[12, 12, 8], [11, 10, 3], [6, 5, 6], [4, 3, 1], [2, 2, 5]]]]
+$rvc_table[21] = Array['c.bnez',     '111XXXXXXXXXXX01', 'bne',    Hash['rs1' => [9, 7, 8], 'rs2' => 0, 'imm' => [[12, 12, 8], [11, 10, 3], [6, 5, 6], [4, 3, 1], [2, 2, 5]]]]
+$rvc_table[22] = Array['c.slli',     '0000XXXXXXXXXX10', 'slli',   Hash['rd' => [11, 7], 'rs1' => [11, 7], 'uimm' => [[6, 2, 0]]]]
+$rvc_table[23] = Array['c.fldsp',    '001XXXXXXXXXXX10', 'fld',    Hash['rd' => [11, 7], 'rs1' => 2, 'uimm' => [[12, 12, 5], [6, 5, 3], [4, 2, 6]]]]
+$rvc_table[24] = Array['reserved',   '010X00000XXXXX10', nil,      Hash[]]  # c.lwsp with rd = 0
+$rvc_table[25] = Array['c.lwsp',     '010XXXXXXXXXXX10', 'lw',     Hash['rd' => [11, 7], 'rs1' => 2, 'uimm' => [[12, 12, 5], [6, 4, 2], [3, 2, 6]]]]
+$rvc_table[26] = Array['c.flwsp',    '011XXXXXXXXXXX10', 'flw',    Hash['rd' => [11, 7], 'rs1' => 2, 'uimm' => [[12, 12, 5], [6, 4, 2], [3, 2, 6]]]]
+$rvc_table[27] = Array['reserved',   '1000000000000010', nil,      Hash[]]  # c.jr with rs1 = 0
+$rvc_table[28] = Array['c.jr',       '1000XXXXX0000010', 'jalr',   Hash['rd' => 0, 'rs1' => [11, 7]]]
+$rvc_table[29] = Array['c.mv',       '1000XXXXXXXXXX10', 'add',    Hash['rd' => [11, 7], 'rs1' => 0, 'rs2' => [6, 2]]]
+$rvc_table[30] = Array['c.ebreak',   '1001000000000010', 'sbreak', Hash[]]
+$rvc_table[31] = Array['c.jalr',     '1001XXXXX0000010', 'jalr',   Hash['rd' => 1, 'rs1' => [11, 7]]]
+$rvc_table[32] = Array['c.add',      '1001XXXXXXXXXX10', 'add',    Hash['rd' => [11, 7], 'rs1' => [11, 7], 'rs2' => [6, 2]]]
+$rvc_table[33] = Array['c.fsdsp',    '101XXXXXXXXXXX10', 'fsd',    Hash['rs1' => 2, 'rs2' => [6, 2], 'uimm' => [[12, 10, 3], [9, 7, 6]]]]
+$rvc_table[34] = Array['c.swsp',     '110XXXXXXXXXXX10', 'sw',     Hash['rs1' => 2, 'rs2' => [6, 2], 'uimm' => [[12, 9, 2], [8, 7, 6]]]]
+$rvc_table[35] = Array['c.fswsp',    '111XXXXXXXXXXX10', 'fsw',    Hash['rs1' => 2, 'rs2' => [6, 2], 'uimm' => [[12, 9, 2], [8, 7, 6]]]]
@@ -1,65 +1,286 @@
-/*
- * Copyright (c) 2015, Masayuki Kimura
- * All rights reserved.
- *
- *     Redistribution and use in source and binary forms, with or without
- *     modification, are permitted provided that the following conditions are met:
- *     * Redistributions of source code must retain the above copyright
- *     notice, this list of conditions and the following disclaimer.
- *     * Redistributions in binary form must reproduce the above copyright
- *     notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *     * Neither the name of the Masayuki Kimura nor the
- *       names of its contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
- *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#include <stdint.h>
-#include <stdlib.h>
-#include "./inst_decoder.h"
-#include "./env.h"
-#include "./inst_print.h"
-
-extern void (* const inst_exec_func[])(uint32_t, riscvEnv);
-
-/*!
- * step instruction
- */
-void StepSimulation (int32_t stepCount, riscvEnv env)
-{
-    for (; stepCount > 0; stepCount--) {
-        clearTraceInfo (env->trace);
-        env->current_pc = env->pc;
-        Word_t    inst_hex = FetchMemory (env->pc, env);
-        uint32_t  inst_idx = RISCV_DEC (inst_hex);
-        if (inst_idx == -1) {
-            fprintf (env->dbgfp, "<Error: instruction is not decoded. [%08x]=%08x\n", env->pc, inst_hex);
-            exit (EXIT_FAILURE);
-        } else {
-            inst_exec_func[inst_idx] (inst_hex, env);
-
-            fprintf (env->dbgfp, "%10d : ", env->step);
-            fprintf (env->dbgfp, "[%08x] %08x : ", env->current_pc, inst_hex);
-            char inst_string[31];
-            PrintInst (inst_hex, inst_idx,
-                       inst_string, 30,
-                       env);
-            fprintf (env->dbgfp, "%-30s  ", inst_string);
-            PrintOperand (env);
-        }
-        fprintf (env->dbgfp, "\n");
-        AdvanceStep (env);
-    }
-    return;
-}
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "./inst_decoder.h"
+#include "./env.h"
+#include "./inst_print.h"
+#include "./simulation.h"
+#include "./trace_file.h"
+#include "./log_writer.h"
+#include "./block.h"
+#include "./jit.h"
+
+/*!
+ * pass record of executed instruction to log sink
+ * \param sink  execModeLog, execModeBinTrace or execModeAsyncLog
+ * \param out   file of binary trace, or log writer
+ */
+static inline void WriteStepRecord (execMode sink, void *out, UDWord_t step, Addr_t pc,
+                                    Word_t inst_hex, uint32_t inst_idx, riscvEnv env)
+{
+    switch (sink) {
+    case execModeBinTrace :
+        WriteTraceRecord ((FILE *)out, step, pc, inst_hex, inst_idx, env->trace);
+        break;
+    case execModeAsyncLog :
+        PushLogRecord ((logWriter)out, step, pc, inst_hex, inst_idx, env->trace);
+        break;
+    default :
+        PrintStepLog (env->dbgfp, step, pc, inst_hex, inst_idx, env->trace);
+        break;
+    }
+}
+
+
+/*!
+ * step instruction with trace recording, records are passed to sink.
+ * stops before breakpoint except the first instruction, or when stop is requested.
+ * sink is constant in each caller, so that the switch is folded.
+ */
+static inline void StepSimulationLog (uint32_t stepCount, execMode sink, void *out, riscvEnv env)
+{
+    bool first = true;
+    for (; stepCount > 0; stepCount--) {
+        clearTraceInfo (env->trace);
+        env->current_pc = env->pc;
+        decodedInst *inst = FetchDecodedInst (env->pc, env);
+        if (inst->breakpoint && first == false) {
+            env->stop_reason = stopBreakpoint;
+            break;
+        }
+        first = false;
+        env->inst_len = inst->inst_len;
+        if (inst->inst_idx == -1) {
+            WriteStepRecord (sink, out, env->step, env->pc, inst->inst_hex, -1, env);
+            if (sink == execModeAsyncLog) {
+                CloseLogWriter ((logWriter)out);
+            }
+            exit (EXIT_FAILURE);
+        }
+        inst->exec (&inst->operand, env);
+
+        WriteStepRecord (sink, out, env->step, env->current_pc, inst->inst_hex, inst->inst_idx, env);
+        AdvanceStep (env);
+        if (env->stop_reason != stopNone) {
+            break;
+        }
+    }
+}
+
+
+/*!
+ * step instruction
+ * stops before breakpoint except the first instruction, or when stop is requested.
+ */
+void StepSimulation (int32_t stepCount, riscvEnv env)
+{
+    if (stepCount > 0) {
+        StepSimulationLog (stepCount, execModeLog, NULL, env);
+    }
+}
+
+
+/*!
+ * step instruction, and write binary trace instead of text log
+ * \param stepCount  number of steps
+ * \param fp         file pointer of binary trace
+ * \param env        RISC-V environment
+ */
+void StepSimulationBinTrace (uint32_t stepCount, FILE *fp, riscvEnv env)
+{
+    StepSimulationLog (stepCount, execModeBinTrace, fp, env);
+}
+
+
+/*!
+ * step instruction, and pass log to asynchronous writer
+ * \param stepCount  number of steps
+ * \param lw         log writer
+ * \param env        RISC-V environment
+ */
+void StepSimulationAsyncLog (uint32_t stepCount, logWriter lw, riscvEnv env)
+{
+    StepSimulationLog (stepCount, execModeAsyncLog, lw, env);
+}
+
+
+/*!
+ * step instruction without trace recording and log output
+ */
+void StepSimulationNoTrace (uint32_t stepCount, riscvEnv env)
+{
+    bool first = true;
+    for (; stepCount > 0; stepCount--) {
+        env->trace->isbranch = false;
+        env->current_pc = env->pc;
+        decodedInst *inst = FetchDecodedInst (env->pc, env);
+        if (inst->breakpoint && first == false) {
+            env->stop_reason = stopBreakpoint;
+            break;
+        }
+        first = false;
+        env->inst_len = inst->inst_len;
+        if (inst->inst_idx == -1) {
+            fprintf (env->dbgfp, "<Error: instruction is not decoded. [%08x]=%08x\n", env->pc, inst->inst_hex);
+            exit (EXIT_FAILURE);
+        }
+        inst->exec_notrace (&inst->operand, env);
+
+        env->step++;
+        if (env->trace->isbranch == false) {
+            env->pc += inst->inst_len;
+        }
+        if (env->stop_reason != stopNone) {
+            break;
+        }
+    }
+    return;
+}
+
+
+/*!
+ * current wall-clock time in seconds
+ */
+double GetTime (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+/*!
+ * run engine of env->exec_mode for one batch
+ */
+static void RunBatch (uint32_t steps, riscvEnv env)
+{
+    switch (env->exec_mode) {
+    case execModeLog      : StepSimulation (steps, env);                           break;
+    case execModeNoTrace  : StepSimulationNoTrace (steps, env);                    break;
+    case execModeBinTrace : StepSimulationBinTrace (steps, env->trace_fp, env);    break;
+    case execModeAsyncLog : StepSimulationAsyncLog (steps, env->log_writer, env);  break;
+    case execModeBlock    : ExecBlockSimulation (steps, env);                      break;
+    }
+}
+
+
+/*!
+ * run simulation until one of stop conditions is satisfied
+ * engine runs in batches of RUN_BATCH_STEPS, and checks conditions only at
+ * block boundaries. budget and deadline are checked between batches.
+ * \param env   RISC-V environment
+ * \param stop  stop conditions
+ * \return      reason of stop
+ */
+stopReason RunSimulation (riscvEnv env, const stopConditions *stop)
+{
+    /* breakpoints are recorded in pre-decoded instructions and blocks.
+       same conditions may be passed again to continue, they are kept then. */
+    if (env->stop != stop &&
+        ((stop->breakpoint_count != 0) ||
+         (env->stop != NULL && env->stop->breakpoint_count != 0))) {
+        FlushDecCache (env);
+        FlushBlockCache (env);
+    }
+    env->stop        = stop;
+    env->stop_reason = stopNone;
+
+    double   deadline = (stop->time_limit > 0.0) ? GetTime () + stop->time_limit : 0.0;
+    UDWord_t start    = env->step;
+    bool     first    = true;
+
+    for (;;) {
+        UDWord_t batch = RUN_BATCH_STEPS;
+        if (stop->max_steps != 0) {
+            UDWord_t executed = env->step - start;
+            if (executed >= stop->max_steps) {
+                env->stop_reason = stopBudget;
+                break;
+            }
+            if (stop->max_steps - executed < batch) {
+                batch = stop->max_steps - executed;
+            }
+        }
+        if (first == false && IsBreakpoint (env->pc, env)) {
+            env->stop_reason = stopBreakpoint;
+            break;
+        }
+        first = false;
+
+        RunBatch (batch, env);
+
+        if (env->stop_reason != stopNone) {
+            break;
+        }
+        if (deadline != 0.0 && GetTime () >= deadline) {
+            env->stop_reason = stopTimeLimit;
+            break;
+        }
+    }
+    return env->stop_reason;
+}
+
+
+/*!
+ * print simulation statistics
+ * \param fp   file pointer to be printed
+ * \param env  RISC-V environment
+ */
+void PrintStatistics (FILE *fp, riscvEnv env)
+{
+    UDWord_t tlb_total = env->tlb_hit + env->tlb_miss;
+
+    fprintf (fp, "<Statistics>\n");
+    fprintf (fp, "  Executed steps : %llu\n", (unsigned long long)env->step);
+    fprintf (fp, "  TLB hit        : %llu\n", (unsigned long long)env->tlb_hit);
+    fprintf (fp, "  TLB miss       : %llu\n", (unsigned long long)env->tlb_miss);
+    fprintf (fp, "  TLB hit ratio  : %.2f%%\n",
+             tlb_total == 0 ? 0.0 : (double)env->tlb_hit * 100.0 / tlb_total);
+    fprintf (fp, "  Decode hit     : %llu\n", (unsigned long long)env->dec_hit);
+    fprintf (fp, "  Decode miss    : %llu\n", (unsigned long long)env->dec_miss);
+    if (env->block_cache != NULL) {
+        blockCache bc = env->block_cache;
+        fprintf (fp, "  Blocks built   : %llu\n", (unsigned long long)bc->built);
+        fprintf (fp, "  Blocks chained : %llu\n", (unsigned long long)bc->chained);
+        fprintf (fp, "  Block flushes  : %llu\n", (unsigned long long)bc->flushes);
+        fprintf (fp, "  Fused pairs    :\n");
+        uint32_t i;
+        for (i = 0; i < fuseTail; i++) {
+            fprintf (fp, "    %-14s : %llu\n", block_fusion_name[i], (unsigned long long)bc->fused[i]);
+        }
+    }
+    if (env->jit_cache != NULL) {
+        jitCache jc = env->jit_cache;
+        fprintf (fp, "  JIT translated : %llu\n", (unsigned long long)jc->translated);
+        fprintf (fp, "  JIT rejected   : %llu\n", (unsigned long long)jc->rejected);
+        fprintf (fp, "  JIT flushes    : %llu\n", (unsigned long long)jc->flushes);
+    }
+    return;
+}
@@ -26,19 +26,46 @@
  */
 
 #include <unistd.h>
+#include <getopt.h>
 #include <string.h>
 #include "./swimmer_main.h"
 #include "./simulation.h"
 #include "./env.h"
+#include "./block.h"
+#include "./jit.h"
+#include "./trace_file.h"
+#include "./disasm.h"
+#include "./elf_loader.h"
+#include "./checkpoint.h"
+#include "./image_cache.h"
+#include "./hart.h"
+
+static FILE *OpenHartFile (const char *, uint32_t, const char *);
 
 int main (int argc, char *argv[])
 {
-    FILE *hexfp;
+    FILE *hexfp = NULL;
     FILE *debugfp = stdout;
 
     char debug_out = false;    //
+    char print_stat = false;   // print statistics at the end
+    char block_mode = false;   // execute by basic blocks without trace
+    char jit_mode = false;     // translate hot blocks into host code
+    char quiet_mode = false;   // no trace recording and instruction log
+    char disasm_mode = false;  // disassemble loaded image instead of simulation
+    char compress_checkpoint = false;  // compress pages of checkpoint written by -w
+    uint32_t log_threads = 0;  // formatter threads of asynchronous log, 0 is synchronous
     char *debug_filename = NULL,
-        *input_filename = NULL;
+        *input_filename = NULL,
+        *trace_filename = NULL,
+        *checkpoint_filename = NULL,
+        *image_cache_filename = NULL;
+    char    **resume_filenames = NULL;     // restored in given order
+    uint32_t  resume_count = 0;
+    UDWord_t  checkpoint_interval = 0;     // steps between periodic checkpoints
+    uint32_t  hart_count = 1;
+    char      deterministic = false;       // run harts by turns on one thread
+    uint32_t  quantum = HART_QUANTUM_DEFAULT;
 
     /*!
      * variables for getopt
@@ -46,9 +73,23 @@ int main (int argc, char *argv[])
     int     ch;
     extern char *optarg;
     extern int  optind, opterr;
-    uint32_t  max_cycle = 65536;   // max cycle (default is 65536)
+    static const struct option long_options[] = {
+        {"disasm",   no_argument, NULL, 0x100},
+        {"compress", no_argument, NULL, 0x101},
+        {"checkpoint-every", required_argument, NULL, 0x102},
+        {"image-cache", required_argument, NULL, 0x103},
+        {"harts",    required_argument, NULL, 0x104},
+        {"deterministic", no_argument, NULL, 0x105},
+        {"quantum",  required_argument, NULL, 0x106},
+        {NULL,       0,           NULL, 0},
+    };
+    UDWord_t  max_cycle = 65536;   // max cycle (default is 65536)
+    memType   mem_type  = memTypePaged;
+    stopConditions stop;
+    Addr_t   *breakpoints = NULL;
+    memset (&stop, 0, sizeof (stop));
 
-    while ((ch = getopt(argc, argv, "h:o:c:")) != -1){
+    while ((ch = getopt_long(argc, argv, "h:o:c:m:sbjqt:a:B:T:xl:r:w:", long_options, NULL)) != -1){
         switch (ch){
         case 'h':  // hex file
             input_filename = optarg;
@@ -58,7 +99,79 @@ int main (int argc, char *argv[])
             debug_out = true;
             break;
         case 'c':  // max cycle
-            max_cycle = atoi (optarg);
+            max_cycle = strtoull (optarg, NULL, 0);
+            break;
+        case 'm':  // memory backend
+            if (strcmp (optarg, "paged") == 0) {
+                mem_type = memTypePaged;
+            } else if (strcmp (optarg, "mmap") == 0) {
+                mem_type = memTypeMmap;
+            } else {
+                fprintf (stderr, "Unknown memory type %s\n", optarg);
+                usage (stderr);
+                exit (EXIT_FAILURE);
+            }
+            break;
+        case 's':  // statistics
+            print_stat = true;
+            break;
+        case 'b':  // basic block engine
+            block_mode = true;
+            break;
+        case 'j':  // JIT, on top of basic block engine
+            block_mode = true;
+            jit_mode = true;
+            break;
+        case 'q':  // untraced step execution
+            quiet_mode = true;
+            break;
+        case 't':  // binary trace file
+            trace_filename = optarg;
+            break;
+        case 'a':  // asynchronous log writer
+            log_threads = atoi (optarg);
+            break;
+        case 'B':  // breakpoint
+            breakpoints = (Addr_t *) realloc (breakpoints, sizeof (Addr_t) * (stop.breakpoint_count + 1));
+            breakpoints[stop.breakpoint_count++] = strtoul (optarg, NULL, 16);
+            break;
+        case 'T':  // tohost address
+            stop.tohost_enable = true;
+            stop.tohost_addr   = strtoul (optarg, NULL, 16);
+            break;
+        case 'x':  // exit by ecall
+            stop.ecall_exit = true;
+            break;
+        case 'l':  // time limit
+            stop.time_limit = atof (optarg);
+            break;
+        case 'r':  // resume from checkpoint, delta checkpoints follow
+            resume_filenames = (char **) realloc (resume_filenames, sizeof (char *) * (resume_count + 1));
+            resume_filenames[resume_count++] = optarg;
+            break;
+        case 'w':  // write checkpoint at the end
+            checkpoint_filename = optarg;
+            break;
+        case 0x100:  // disassemble loaded image
+            disasm_mode = true;
+            break;
+        case 0x101:  // compress checkpoint
+            compress_checkpoint = true;
+            break;
+        case 0x102:  // periodic checkpoint
+            checkpoint_interval = strtoull (optarg, NULL, 0);
+            break;
+        case 0x103:  // image cache file
+            image_cache_filename = optarg;
+            break;
+        case 0x104:  // number of harts
+            hart_count = atoi (optarg);
+            break;
+        case 0x105:  // deterministic multi-hart simulation
+            deterministic = true;
+            break;
+        case 0x106:  // steps of each turn in deterministic mode
+            quantum = strtoul (optarg, NULL, 0);
             break;
         default:
             usage(stderr);
@@ -66,23 +179,34 @@ int main (int argc, char *argv[])
     }
     argc -= optind;
     argv += optind;
-    if (input_filename == NULL) {
+    if (input_filename == NULL && resume_count == 0) {
         fprintf (stderr, "Please specify input binary file\n\n");
         display_info (stderr);
         usage (stderr);
         exit (EXIT_FAILURE);
     }
+    if (hart_count < 1 || hart_count > HART_MAX || quantum == 0) {
+        fprintf (stderr, "Number of harts must be 1 to %d, and quantum must not be 0\n", HART_MAX);
+        exit (EXIT_FAILURE);
+    }
+    if (hart_count > 1 && (log_threads != 0 || checkpoint_filename != NULL || resume_count != 0)) {
+        fprintf (stderr, "-a, -w and -r are not supported with multiple harts\n");
+        exit (EXIT_FAILURE);
+    }
+
+    // harts on threads write their own log, <log>.<hart id>
+    bool hart_logs = (hart_count > 1 && deterministic == false && debug_out == true);
 
     // opening debug out
-    if (debug_out == true) {
+    if (debug_out == true && hart_logs == false) {
         if ((debugfp = fopen(debug_filename, "w")) == NULL) {
             perror ("fopen");
             exit (EXIT_FAILURE);
         }
     }
 
-    // opening input binary file
-    if ((hexfp = fopen(input_filename, "r")) == NULL) {
+    // opening input binary file, which can be omitted when resuming
+    if (input_filename != NULL && (hexfp = fopen(input_filename, "rb")) == NULL) {
         perror ("fopen");
         exit (EXIT_FAILURE);
     }
@@ -90,23 +214,179 @@ int main (int argc, char *argv[])
     display_info (stdout);
 
     // for instruction simulation mode
-    riscvEnv env = CreateNewRISCVEnv (debugfp);
+    riscvEnv env = CreateNewRISCVEnv (debugfp, mem_type);
     env->max_cycle = max_cycle;  // set maximum cycle
+    if (jit_mode == true) {
+        env->jit_cache = CreateJITCache ();
+    }
+
+    // image cache is used while it matches hash of input file
+    imageSource source;
+    bool use_cache = (image_cache_filename != NULL && hexfp != NULL &&
+                      HashImageSource (hexfp, &source) == true);
+
+    // ELF sets PC to its entry point, s-record starts from address 0
+    if (hexfp == NULL) {
+        // state comes from checkpoint only
+    } else if (use_cache == true && LoadImageCache (image_cache_filename, &source, env) == true) {
+        // loaded from cache
+    } else {
+        if (IsElfImage (hexfp) == true) {
+            if (LoadElf (hexfp, env) == false) {
+                exit (EXIT_FAILURE);
+            }
+        } else {
+            LoadSrec (hexfp, env);
+        }
+        if (use_cache == true) {
+            SaveImageCache (image_cache_filename, &source, env);
+        }
+    }
+    for (uint32_t i = 0; i < resume_count; i++) {
+        if (LoadCheckpoint (resume_filenames[i], env) == false) {
+            exit (EXIT_FAILURE);
+        }
+    }
 
-    LoadSrec (hexfp, env);
+    if (disasm_mode == true) {
+        // use -a as number of threads, all cores by default
+        uint32_t threads = log_threads;
+        if (threads == 0) {
+            long cores = sysconf (_SC_NPROCESSORS_ONLN);
+            threads = (cores > 0) ? cores : 1;
+        }
+        DisassembleImage (debugfp, env, threads);
+        fflush (debugfp);
+        exit (EXIT_SUCCESS);
+    }
 
     // simulation start
-    FormatOperand ();
-    env->pc = 0x00000000;
-    int count;
-    for (count = 0; count < env->max_cycle; count++) {
-        StepSimulation (1, env);
+    if (block_mode == true) {
+        env->exec_mode = execModeBlock;
+    } else if (quiet_mode == true) {
+        env->exec_mode = execModeNoTrace;
+    } else if (trace_filename != NULL) {
+        env->exec_mode = execModeBinTrace;
+    } else if (log_threads > 0) {
+        env->log_writer = CreateLogWriter (debugfp, log_threads);
+        env->exec_mode = execModeAsyncLog;
+    } else {
+        env->exec_mode = execModeLog;
     }
 
-    fclose (hexfp);
-    return 0;
+    // hart 0 is env itself, others share its memory
+    hartGroup group = CreateHartGroup (env, hart_count);
+    uint32_t  i;
+    for (i = 0; i < hart_count; i++) {
+        riscvEnv hart = group->harts[i];
+        if (hart_logs == true) {
+            hart->dbgfp = OpenHartFile (debug_filename, i, "w");
+        }
+        if (hart->exec_mode == execModeBinTrace) {
+            // binary trace has no hart marker, each hart writes its own file
+            hart->trace_fp = (hart_count == 1) ? fopen (trace_filename, "wb") :
+                                                 OpenHartFile (trace_filename, i, "wb");
+            if (hart->trace_fp == NULL) {
+                perror ("fopen");
+                exit (EXIT_FAILURE);
+            }
+            setvbuf (hart->trace_fp, NULL, _IOFBF, 1 << 20);
+            WriteTraceFileHeader (hart->trace_fp);
+        }
+    }
+
+    stop.max_steps   = env->max_cycle;
+    stop.breakpoints = breakpoints;
+    stopReason reason;
+    if (hart_count > 1) {
+        reason = RunHartGroup (group, &stop, deterministic, quantum);
+    } else if (checkpoint_interval != 0 && checkpoint_filename != NULL) {
+        reason = RunSimulationWithCheckpoints (env, &stop, checkpoint_interval,
+                                               checkpoint_filename, compress_checkpoint);
+    } else {
+        reason = RunSimulation (env, &stop);
+    }
+
+    for (i = 0; i < hart_count; i++) {
+        riscvEnv hart = group->harts[i];
+        if (hart->trace_fp != NULL) {
+            fclose (hart->trace_fp);
+        }
+        if (hart_logs == true) {
+            fclose (hart->dbgfp);
+        }
+    }
+    if (env->log_writer != NULL) {
+        CloseLogWriter (env->log_writer);
+    }
+
+    // messages are about the hart which stopped the group
+    riscvEnv stopped = group->harts[group->stopped_hart];
+    if (hart_count > 1 && reason != stopBudget) {
+        fprintf (stdout, "<Hart %u>\n", stopped->hart_id);
+    }
+    int exit_code = 0;
+    switch (reason) {
+    case stopBreakpoint :
+        fprintf (stdout, "<Stop: breakpoint at %08x, step %llu>\n", stopped->pc, (unsigned long long)stopped->step);
+        break;
+    case stopToHost :
+        fprintf (stdout, "<Stop: tohost, exit code %d>\n", stopped->exit_code);
+        exit_code = stopped->exit_code;
+        break;
+    case stopExit :
+        fprintf (stdout, "<Stop: exit, exit code %d>\n", stopped->exit_code);
+        exit_code = stopped->exit_code;
+        break;
+    case stopTimeLimit :
+        fprintf (stdout, "<Stop: time limit, step %llu>\n", (unsigned long long)stopped->step);
+        break;
+    default :
+        break;
+    }
+
+    if (checkpoint_filename != NULL &&
+        SaveCheckpoint (checkpoint_filename, compress_checkpoint, env) == false) {
+        exit_code = EXIT_FAILURE;
+    }
+
+    if (print_stat == true) {
+        for (i = 0; i < hart_count; i++) {
+            if (hart_count > 1) {
+                fprintf (stdout, "<Hart %u>\n", i);
+            }
+            PrintStatistics (stdout, group->harts[i]);
+        }
+    }
+    DestroyHartGroup (group);
+
+    if (hexfp != NULL) {
+        fclose (hexfp);
+    }
+    free (breakpoints);
+    free (resume_filenames);
+    return exit_code;
+}
+
+/*!
+ * open file of hart, <basename>.<hart id>
+ * \param basename  file name given by option
+ * \param hart_id   hart
+ * \param mode      mode of fopen
+ */
+static FILE *OpenHartFile (const char *basename, uint32_t hart_id, const char *mode)
+{
+    char filename[4096];
+    snprintf (filename, sizeof (filename), "%s.%u", basename, hart_id);
+    FILE *fp = fopen (filename, mode);
+    if (fp == NULL) {
+        perror ("fopen");
+        exit (EXIT_FAILURE);
+    }
+    return fp;
 }
 
+
 /*!
  * print mipsim start file
  * \param fp   file pointer
@@ -128,8 +408,31 @@ void usage (FILE *fp)
     fprintf (fp, "\n");
     fprintf (fp, "  usage : swimmer_riscv -h <filename>\n\n");
     fprintf (fp, "Options\n");
-    fprintf (fp, "    -c <int>   : simulation step\n");
+    fprintf (fp, "    -c <int>   : simulation step (default 65536), 0 runs until other stop condition\n");
     fprintf (fp, "    -o <log>   : log file name\n");
+    fprintf (fp, "    -m <type>  : guest memory backend, paged (default) or mmap\n");
+    fprintf (fp, "    -B <addr>  : stop before executing instruction at hex address, repeatable\n");
+    fprintf (fp, "    -T <addr>  : stop when program stores to tohost at hex address\n");
+    fprintf (fp, "    -x         : stop when program calls exit system call by ecall\n");
+    fprintf (fp, "    -l <sec>   : stop after given wall-clock seconds\n");
+    fprintf (fp, "    -s         : print statistics at the end of simulation\n");
+    fprintf (fp, "    -t <file>  : write binary trace instead of log, decoded by swimmer_trace\n");
+    fprintf (fp, "    -a <int>   : format log by given number of background threads\n");
+    fprintf (fp, "    -q         : execute without trace recording, instruction log is not generated\n");
+    fprintf (fp, "    -b         : execute by basic blocks, instruction log is not generated\n");
+    fprintf (fp, "    -j         : same as -b, and translate hot blocks into x86-64 code\n");
+    fprintf (fp, "    -w <file>  : write checkpoint at the end of simulation\n");
+    fprintf (fp, "    -r <file>  : resume from checkpoint, -h can be omitted. repeat -r to restore deltas\n");
+    fprintf (fp, "    --compress : compress pages of checkpoint written by -w\n");
+    fprintf (fp, "    --checkpoint-every <int> : also write <file of -w>.N every given steps,\n");
+    fprintf (fp, "                               .0 is full and others are delta checkpoints\n");
+    fprintf (fp, "    --image-cache <file> : load image from cache file, which is written if it is\n");
+    fprintf (fp, "                           missing or does not match input file\n");
+    fprintf (fp, "    --disasm   : disassemble loaded image and exit, threads are given by -a\n");
+    fprintf (fp, "    --harts <int>   : number of harts (1-%d) sharing memory, each runs -c steps\n", HART_MAX);
+    fprintf (fp, "                      on its own thread. -o and -t are written to <file>.<hart>\n");
+    fprintf (fp, "    --deterministic : run harts by turns on one thread, log of -o is shared\n");
+    fprintf (fp, "    --quantum <int> : steps of each turn in deterministic mode (default %d)\n", HART_QUANTUM_DEFAULT);
 
     return;
 }
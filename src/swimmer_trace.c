@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "./trace.h"
+#include "./trace_file.h"
+#include "./inst_print.h"
+
+static void usage (FILE *);
+
+/*!
+ * decode binary trace of swimmer_riscv into text log
+ */
+int main (int argc, char *argv[])
+{
+    FILE *tracefp;
+    FILE *outfp = stdout;
+    char *out_filename = NULL;
+
+    /*!
+     * variables for getopt
+     */
+    int     ch;
+    extern char *optarg;
+    extern int  optind, opterr;
+
+    while ((ch = getopt(argc, argv, "o:")) != -1){
+        switch (ch){
+        case 'o':  // output file
+            out_filename = optarg;
+            break;
+        default:
+            usage (stderr);
+            exit (EXIT_FAILURE);
+        }
+    }
+    argc -= optind;
+    argv += optind;
+    if (argc != 1) {
+        usage (stderr);
+        exit (EXIT_FAILURE);
+    }
+
+    if ((tracefp = fopen (argv[0], "rb")) == NULL) {
+        perror ("fopen");
+        exit (EXIT_FAILURE);
+    }
+    if (ReadTraceFileHeader (tracefp) == false) {
+        fprintf (stderr, "%s is not a trace file of swimmer_riscv\n", argv[0]);
+        exit (EXIT_FAILURE);
+    }
+    if (out_filename != NULL) {
+        if ((outfp = fopen (out_filename, "w")) == NULL) {
+            perror ("fopen");
+            exit (EXIT_FAILURE);
+        }
+    }
+
+    traceRecordHeader  header;
+    struct __traceInfo trace;
+    while (ReadTraceRecord (tracefp, &header, &trace) == true) {
+        uint32_t inst_idx = (header.inst_idx == TRACE_INST_ILLEGAL) ? -1 : header.inst_idx;
+        PrintStepLog (outfp, header.step, header.pc, header.inst_hex, inst_idx, &trace);
+    }
+
+    fclose (tracefp);
+    if (outfp != stdout) {
+        fclose (outfp);
+    }
+    return 0;
+}
+
+
+/*!
+ * display usage
+ * \param fp   file pointer to be displaying of usage information
+ */
+static void usage (FILE *fp)
+{
+    fprintf (fp, "\n");
+    fprintf (fp, "  usage : swimmer_trace [-o <log>] <trace file>\n\n");
+    fprintf (fp, "Options\n");
+    fprintf (fp, "    -o <log>   : log file name, default is stdout\n");
+    return;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "./trace.h"
+#include "./trace_file.h"
+
+
+/*!
+ * write header of binary trace
+ * \param fp  file pointer of trace
+ */
+void WriteTraceFileHeader (FILE *fp)
+{
+    traceFileHeader header;
+    memcpy (header.magic, TRACE_FILE_MAGIC, sizeof (header.magic));
+    header.version = TRACE_FILE_VERSION;
+    fwrite (&header, sizeof (header), 1, fp);
+}
+
+
+/*!
+ * read and check header of binary trace
+ * \param fp  file pointer of trace
+ * \return    true if file is binary trace of supported version
+ */
+bool ReadTraceFileHeader (FILE *fp)
+{
+    traceFileHeader header;
+    if (fread (&header, sizeof (header), 1, fp) != 1) {
+        return false;
+    }
+    return memcmp (header.magic, TRACE_FILE_MAGIC, sizeof (header.magic)) == 0 &&
+        header.version == TRACE_FILE_VERSION;
+}
+
+
+/*!
+ * encode one step into binary record
+ * \param buf       output buffer, TRACE_RECORD_MAX_SIZE bytes at least
+ * \param step      step number
+ * \param pc        PC of instruction
+ * \param inst_hex  instruction
+ * \param inst_idx  index of instruction, -1 if not decoded
+ * \param trace     trace of step
+ * \return          size of record
+ */
+uint32_t EncodeTraceRecord (Byte_t *buf, UDWord_t step, Addr_t pc,
+                            Word_t inst_hex, uint32_t inst_idx, traceInfo trace)
+{
+    traceRecordHeader  header;
+    traceRecordEntry  *entries = (traceRecordEntry *)(buf + sizeof (traceRecordHeader));
+
+    header.step     = step;
+    header.pc       = pc;
+    header.inst_hex = inst_hex;
+    header.inst_idx = (inst_idx == -1) ? TRACE_INST_ILLEGAL : inst_idx;
+    header.count    = trace->max;
+    header.isbranch = trace->isbranch;
+    header.reserved = 0;
+    memcpy (buf, &header, sizeof (header));
+
+    uint32_t i;
+    for (i = 0; i < trace->max; i++) {
+        entries[i].type  = trace->trace_type[i];
+        entries[i].reserved[0] = entries[i].reserved[1] = entries[i].reserved[2] = 0;
+        entries[i].addr  = trace->trace_addr[i];
+        entries[i].value = trace->trace_value[i];
+    }
+    return sizeof (traceRecordHeader) + sizeof (traceRecordEntry) * trace->max;
+}
+
+
+/*!
+ * decode binary record
+ * \param buf     encoded record
+ * \param header  record header to be decoded
+ * \param trace   trace entries to be decoded
+ * \return        size of record
+ */
+uint32_t DecodeTraceRecord (const Byte_t *buf, traceRecordHeader *header, traceInfo trace)
+{
+    const traceRecordEntry *entries = (const traceRecordEntry *)(buf + sizeof (traceRecordHeader));
+    memcpy (header, buf, sizeof (*header));
+
+    uint32_t i;
+    trace->max      = header->count;
+    trace->isbranch = header->isbranch;
+    for (i = 0; i < header->count; i++) {
+        trace->trace_type [i] = entries[i].type;
+        trace->trace_addr [i] = entries[i].addr;
+        trace->trace_value[i] = entries[i].value;
+    }
+    return sizeof (traceRecordHeader) + sizeof (traceRecordEntry) * header->count;
+}
+
+
+/*!
+ * write one step into binary trace
+ */
+void WriteTraceRecord (FILE *fp, UDWord_t step, Addr_t pc,
+                       Word_t inst_hex, uint32_t inst_idx, traceInfo trace)
+{
+    Byte_t   buf[TRACE_RECORD_MAX_SIZE];
+    uint32_t size = EncodeTraceRecord (buf, step, pc, inst_hex, inst_idx, trace);
+    fwrite (buf, size, 1, fp);
+}
+
+
+/*!
+ * read one step from binary trace
+ * \param fp      file pointer of trace
+ * \param header  record header to be read
+ * \param trace   trace entries to be read
+ * \return        false at the end of file
+ */
+bool ReadTraceRecord (FILE *fp, traceRecordHeader *header, traceInfo trace)
+{
+    if (fread (header, sizeof (*header), 1, fp) != 1 ||
+        header->count > TRACE_MAX) {
+        return false;
+    }
+
+    traceRecordEntry entries[TRACE_MAX];
+    if (fread (entries, sizeof (traceRecordEntry), header->count, fp) != header->count) {
+        return false;
+    }
+
+    uint32_t i;
+    trace->max      = header->count;
+    trace->isbranch = header->isbranch;
+    for (i = 0; i < header->count; i++) {
+        trace->trace_type [i] = entries[i].type;
+        trace->trace_addr [i] = entries[i].addr;
+        trace->trace_value[i] = entries[i].value;
+    }
+    return true;
+}
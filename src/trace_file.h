@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2015, Masayuki Kimura
+ * All rights reserved.
+ *
+ *     Redistribution and use in source and binary forms, with or without
+ *     modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Masayuki Kimura nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *     ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL MASAYUKI KIMURA BE LIABLE FOR ANY
+ *     DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *     (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *      LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *     ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *     (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include "./basic.h"
+#include "./trace.h"
+
+/*!
+ * Binary execution trace
+ * file header is followed by one record per step. each record is a fixed
+ * size header and 'count' fixed size entries copied from traceInfo.
+ * text log is reproduced offline by swimmer_trace.
+ */
+#define TRACE_FILE_MAGIC    "SWTR"
+#define TRACE_FILE_VERSION  2
+#define TRACE_INST_ILLEGAL  0xffff   // instruction is not decoded
+
+typedef struct {
+    char      magic[4];
+    uint32_t  version;
+} traceFileHeader;
+
+typedef struct {
+    UDWord_t  step;
+    Addr_t    pc;
+    Word_t    inst_hex;
+    uint16_t  inst_idx;
+    uint8_t   count;      // number of traceRecordEntry
+    uint8_t   isbranch;
+    uint32_t  reserved;
+} traceRecordHeader;
+
+typedef struct {
+    uint8_t   type;       // traceType
+    uint8_t   reserved[3];
+    Addr_t    addr;
+    Word_t    value;
+} traceRecordEntry;
+
+#define TRACE_RECORD_MAX_SIZE (sizeof (traceRecordHeader) + sizeof (traceRecordEntry) * TRACE_MAX)
+
+
+void     WriteTraceFileHeader (FILE *);
+bool     ReadTraceFileHeader (FILE *);
+uint32_t EncodeTraceRecord (Byte_t *, UDWord_t, Addr_t, Word_t, uint32_t, traceInfo);
+uint32_t DecodeTraceRecord (const Byte_t *, traceRecordHeader *, traceInfo);
+void     WriteTraceRecord (FILE *, UDWord_t, Addr_t, Word_t, uint32_t, traceInfo);
+bool     ReadTraceRecord (FILE *, traceRecordHeader *, traceInfo);